@@ -0,0 +1,272 @@
+/**
+ * @file    batch.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The output that collects the short lines into the packet-sized blocks (USB CDC, RTT):
+ *          the block is passed to the output when it is full, the deadline has passed or the urgent line is placed.
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <tuple>
+
+#include "log.hpp"
+#include "pingpong.hpp"
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief           Lock-free batching output: the lines are copied into the filled block and the block is passed to the output at once
+ *                  when the next line doesn't fit, the deadline from the first line of the block has passed or the line is urgent
+ *                  (the Log passes the traces of each level by the view of the level, the urgent ones are passed immediately).
+ *                  The block is passed in the context of the writer, the lines are copied into the other block at the same time
+ *                  (dropped and counted when it is full too). The line that fits into the block is never split. The lines that are
+ *                  longer than the block are passed by the block-sized parts: the lines of the other writers (interrupts) might come
+ *                  between the parts, and if the later part is dropped, the first ones have already been passed (the line is truncated)
+ *
+ * @tparam Output   The type that should be satisfied to iso::format::sink concept (with write() or puts())
+ * @tparam N        Size of the block in bytes (the packet size)
+ * @tparam deadline Max time of the line in the block in the ticks of the Output (0 - only the full and urgent blocks are passed)
+ * @tparam urgent   The lowest level of the traces that are passed immediately
+ *
+ * @example         static iso::output::Batch<UsbCdc, 64, 10> usb{cdc}; // 64-byte packets, 10 ms deadline
+ * @example         static constexpr iso::log::Log debug{usb, iso::format::string<"MAIN">};
+ * @example         usb.poll(); // From the idle task or the timer: the block is passed after the deadline without the new lines
+ */
+template <iso::format::sink Output, const size_t N, const unsigned long deadline = 0, const iso::log::Trace urgent = iso::log::Trace::Error>
+class Batch final {
+  static_assert(N && (N < (1UL << 23)), "ERROR: The size of the block should be less than 8 MiB!");
+  static_assert(!deadline || iso::log::time_func<Output>, "ERROR: The deadline requires tick() of the Output!");
+
+  const Output &out;                                  // Reference to the Output object
+  mutable char blocks[2][N + 1]{};                    // The blocks (with the place for '\0' for puts())
+  const PingPong<N> states{};                         // States of the blocks
+  mutable std::atomic<unsigned long> opened[2]{};     // Time of the first line in the block (for the deadline)
+  mutable std::atomic<bool> due{};                    // The filled block should be passed (full, urgent or after the deadline)
+  mutable std::atomic<bool> busy{};                   // The block is being passed
+  mutable std::atomic<size_t> drops{};                // Quantity of the lines that were dropped (both blocks were full)
+
+  // Pass the block to the output
+  void pass(char *block, const size_t size) const {
+    if constexpr (iso::format::write<Output>) {
+      out.write(block, size);
+    } else {
+      block[size] = '\0';
+      out.puts(block);
+    }
+  }
+
+  // The deadline of the block has passed
+  bool expired(const unsigned index) const {
+    if constexpr (deadline) {
+      return (static_cast<unsigned long>(out.tick()) - opened[index].load(std::memory_order_relaxed)) >= deadline;
+    } else {
+      return false;
+    }
+  }
+
+  // Seal the filled block and pass it, if it is due and nobody is writing to it
+  void kick() const {
+    while (due.load(std::memory_order_acquire) && !busy.exchange(true, std::memory_order_acquire)) {
+      due.store(false, std::memory_order_relaxed); // The request is taken: the later ones are seen by the loop
+      const auto filled = states.current();
+      unsigned index = 0;
+      const auto size = states.seal(index);
+      if (size) {
+        pass(blocks[index], size);
+        states.release(index);
+      }
+      if ((size && (index != filled)) || (!size && states.writing())) {
+        due.store(true, std::memory_order_relaxed); // The late line of the other block is passed first, the last writer passes the block after the copy
+      }
+      busy.store(false, std::memory_order_release);
+
+      // The last writer passes the block after the copy
+      if (!size && !states.pending()) {
+        return;
+      }
+    }
+  }
+
+  // Copy the part of the line (not more than the block) into the filled block
+  bool place(const char *buffer, const size_t size, const bool now) const {
+    for (unsigned attempt = 0; attempt < 3; attempt++) {
+      const auto index = states.current();
+      size_t offset = 0;
+      if (states.reserve(index, size, offset)) {
+        if constexpr (deadline) {
+          if (!offset) {
+            opened[index].store(static_cast<unsigned long>(out.tick()), std::memory_order_relaxed);
+          }
+        }
+        std::memcpy(&blocks[index][offset], buffer, size);
+        states.commit(index);
+        if (now || ((offset + size) == N) || expired(index)) {
+          due.store(true, std::memory_order_release);
+        }
+        kick();
+        return true;
+      }
+
+      // The block is full: it is passed first, then the line goes to the next one
+      due.store(true, std::memory_order_release);
+      kick();
+    }
+    drops.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+public:
+  /**
+   * @brief     Output of the Batch for the traces of one level (the urgent ones pass the block immediately)
+   *
+   * @tparam l  Level of the traces
+   */
+  template <const iso::log::Trace l> class View final {
+    const Batch &batch; // Owner of the blocks
+
+  public:
+    using Wrapped = Batch; // The binary records of all levels are one stream (iso::format::Unwrap)
+
+    constexpr View(const Batch &b) : batch(b) {}
+
+    bool write(const char *data, const size_t size) const { return batch.write(data, size, l >= urgent); }
+    void puts(const char *data) const { batch.write(data, std::strlen(data), l >= urgent); }
+  };
+
+  using Wrapped = Output; // The binary records share the timeline of the Output (iso::format::Unwrap)
+
+private:
+  // Views for all levels (they should live as long as the Batch: the Log keeps the references to them)
+  const std::tuple<View<iso::log::Trace::Trace>, View<iso::log::Trace::Debug>, View<iso::log::Trace::Info>, View<iso::log::Trace::Warn>,
+                   View<iso::log::Trace::Error>, View<iso::log::Trace::Fatal>, View<iso::log::Trace::None>>
+      views;
+
+public:
+  /**
+   * @brief   Constructor for the object (the blocks themselves are constant-initialized)
+   *
+   * @param o Reference to the Output object
+   */
+  constexpr Batch(const Output &o) : out(o), views(*this, *this, *this, *this, *this, *this, *this) {}
+
+  // All levels are passed to the Output (needed for iso::log::routed concept)
+  template <const iso::log::Trace lvl> static constexpr bool accepts = true;
+
+  /**
+   * @brief   View for the traces of the level (needed for iso::log::routed concept)
+   *
+   * @tparam  lvl Level of the traces (from Trace::Trace to Trace::None)
+   * @return  Reference to the view
+   */
+  template <const iso::log::Trace lvl> constexpr const View<lvl> &view() const { return std::get<View<lvl>>(views); }
+
+  /**
+   * @brief         Copy the line to the filled block (safe to call from the interrupts and any thread)
+   *                The line that is longer than the block is copied by the parts (not one transaction, see the class description)
+   *
+   * @param buffer  Line to be copied
+   * @param size    Length of the line
+   * @param now     The block should be passed immediately after the line
+   * @return        True if the line has been copied, false - dropped (both blocks are full, the first parts of the long line are kept)
+   */
+  bool write(const char *buffer, const size_t size, const bool now = false) const {
+    for (size_t i = 0; i < size;) {
+      const auto part = ((size - i) < N) ? (size - i) : N;
+      if (!place(&buffer[i], part, now || ((i + part) < size))) {
+        return false;
+      }
+      i += part;
+    }
+    return true;
+  }
+
+  /**
+   * @brief     Copy the string to the filled block (the length is calculated, write() is preferred by the Format)
+   *
+   * @param buf String to be copied
+   */
+  void puts(const char *buf) const { write(buf, std::strlen(buf)); }
+
+  /**
+   * @brief   Pass the block after the deadline (should be called periodically if the lines can stop: idle task, timer)
+   */
+  void poll() const {
+    for (const unsigned index : {0U, 1U}) {
+      if (states.size(index) && expired(index)) {
+        due.store(true, std::memory_order_release);
+        kick();
+      }
+    }
+  }
+
+  /**
+   * @brief   Pass the filled block immediately (before the sleep, reset, et cetera)
+   */
+  void flush() const {
+    due.store(true, std::memory_order_release);
+    kick();
+  }
+
+  /**
+   * @brief   Pass the time from the Output (needed for iso::log::time concept)
+   *
+   * @return  Time from the Output
+   */
+  auto tick() const
+  requires iso::log::time_func<Output>
+  {
+    return out.tick();
+  }
+
+  /**
+   * @brief   Pass the cycle counter from the Output (needed for iso::log::cycles)
+   *
+   * @return  Cycles from the Output
+   */
+  auto cycles() const
+  requires iso::log::cycles_func<Output>
+  {
+    return out.cycles();
+  }
+
+  /**
+   * @brief   Quantity of the lines that were dropped because both blocks were full
+   *
+   * @return  Quantity of the dropped lines
+   */
+  size_t dropped() const { return drops.load(std::memory_order_relaxed); }
+};
+
+} // namespace iso::output
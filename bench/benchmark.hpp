@@ -0,0 +1,273 @@
+/**
+ * @file    benchmark.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The benchmark of the Format/Log backends compared
+ *          to the std::snprintf (target and host).
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#include "../log.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__arm__)
+#include <chrono>
+#endif
+
+// Benchmark of the formatting backends
+namespace iso::bench {
+
+#if !defined(__arm__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+/**
+ * @brief   Cycle counter: DWT CYCCNT on Cortex-M3 and newer, TSC on x86, nanoseconds of the steady clock on the others
+ *          Cortex-M0/M0+ don't have DWT CYCCNT, so some timer should be passed as Clock to the run()
+ *
+ */
+struct Cycles {
+  inline Cycles() {
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    *reinterpret_cast<volatile std::uint32_t *>(0xE000EDFCUL) |= (1UL << 24); // DEMCR.TRCENA
+    *reinterpret_cast<volatile std::uint32_t *>(0xE0001004UL) = 0;            // DWT.CYCCNT
+    *reinterpret_cast<volatile std::uint32_t *>(0xE0001000UL) |= 1UL;         // DWT.CTRL.CYCCNTENA
+#endif
+  }
+
+  inline std::uint64_t operator()() const {
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    return *reinterpret_cast<volatile std::uint32_t *>(0xE0001004UL);
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+  }
+};
+#endif
+
+// Keep the data visible for the compiler, so the formatting can't be removed
+inline void Consume(const void *data, const size_t size) { asm volatile("" : : "r"(data), "r"(size) : "memory"); }
+
+// Null output for the text and binary backends (length-aware)
+struct Write final {
+  inline void write(const char *buf, const size_t size) const { Consume(buf, size); }
+  inline unsigned long tick() const { return 123456UL; }
+};
+
+// Null output for the scatter-gather backend
+struct Gather final {
+  inline void writev(const iso::format::Segment *segments, const size_t quantity) const {
+    for (size_t i = 0; i < quantity; i++) {
+      Consume(segments[i].data, segments[i].length);
+    }
+  }
+  inline unsigned long tick() const { return 123456UL; }
+};
+
+inline constexpr Write writeOut{};
+inline constexpr Gather gatherOut{};
+inline constexpr iso::format::Format text{writeOut};
+inline constexpr iso::format::Format scatter{gatherOut};
+inline constexpr iso::log::Log logText{writeOut, iso::format::string<"BENCH">, iso::log::log_opt<iso::log::dump<16>>};
+inline constexpr iso::log::Log logBinary{writeOut, iso::format::string<"BENCH">, iso::log::log_opt<iso::log::Encoding::Binary>};
+
+// The arguments are volatile, so the compiler can't format them in the compile-time
+inline volatile int sInt = -123456;
+inline volatile unsigned uInt = 98765U;
+inline volatile unsigned long uLong = 4000000000UL;
+inline volatile char sChar = 'Q';
+inline volatile bool sBool = true;
+inline volatile float sFloat = -273.15F;
+inline volatile std::int16_t sQ15 = -12345;
+inline char data[256];
+
+// snprintf analogue of the output
+template <typename... Args> inline void Snprintf(const char *format, const Args... args) {
+  char buffer[256 * 3 + 64];
+  const auto len = std::snprintf(buffer, sizeof(buffer), format, args...);
+  writeOut.write(buffer, static_cast<size_t>(len));
+}
+
+// snprintf analogue of the data buffer
+inline void SnprintfBuffer(const size_t size) {
+  char buffer[256 * 3 + 64];
+  auto len = std::snprintf(buffer, sizeof(buffer), "Buffer [%u]:", static_cast<unsigned>(size));
+  for (size_t i = 0; i < size; i++) {
+    len += std::snprintf(&buffer[len], sizeof(buffer) - len, " %02X", static_cast<unsigned char>(data[i]));
+  }
+  len += std::snprintf(&buffer[len], sizeof(buffer) - len, "\r\n");
+  writeOut.write(buffer, static_cast<size_t>(len));
+}
+
+/**
+ * @brief   Case of the corpus: each backend is a separate not inlined function (to check the code size with nm)
+ *          nullptr - the backend is not applicable for the case
+ *
+ */
+struct Case {
+  const char *name;
+  void (*text)();
+  void (*scatter)();
+  void (*binary)();
+  void (*snprintf)();
+};
+
+using namespace iso::format;
+
+// clang-format off
+inline constexpr Case corpus[] = {
+  {"1 arg: %u",
+   []() { text.printf(string<"Value %u\r\n">, uInt); },
+   []() { scatter.printf(string<"Value %u\r\n">, uInt); },
+   []() { text.record(string<"Value %u\r\n">, uInt); },
+   []() { Snprintf("Value %u\r\n", uInt); }},
+  {"2 args: %d %X",
+   []() { text.printf(string<"Dec %d and hex %X\r\n">, sInt, uInt); },
+   []() { scatter.printf(string<"Dec %d and hex %X\r\n">, sInt, uInt); },
+   []() { text.record(string<"Dec %d and hex %X\r\n">, sInt, uInt); },
+   []() { Snprintf("Dec %d and hex 0x%08X\r\n", sInt, uInt); }},
+  {"3 args: %u %d %c",
+   []() { text.printf(string<"Values %u, %d, %c\r\n">, uInt, sInt, sChar); },
+   []() { scatter.printf(string<"Values %u, %d, %c\r\n">, uInt, sInt, sChar); },
+   []() { text.record(string<"Values %u, %d, %c\r\n">, uInt, sInt, sChar); },
+   []() { Snprintf("Values %u, %d, %c\r\n", uInt, sInt, sChar); }},
+  {"4 args: %08u %X %b %s",
+   []() { text.printf(string<"Values %08u, %X, %b, %s\r\n">, uInt, uInt, sBool, string<"const">); },
+   []() { scatter.printf(string<"Values %08u, %X, %b, %s\r\n">, uInt, uInt, sBool, string<"const">); },
+   []() { text.record(string<"Values %08u, %X, %b, %s\r\n">, uInt, uInt, sBool, string<"const">); },
+   []() { Snprintf("Values %08u, 0x%08X, %s, %s\r\n", uInt, uInt, sBool ? "TRUE" : "FALSE", "const"); }},
+  {"5 args: %d %u %X %c %p",
+   []() { text.printf(string<"Values %d %u %X %c %p\r\n">, sInt, uInt, uInt, sChar, &data[0]); },
+   []() { scatter.printf(string<"Values %d %u %X %c %p\r\n">, sInt, uInt, uInt, sChar, &data[0]); },
+   []() { text.record(string<"Values %d %u %X %c %p\r\n">, sInt, uInt, uInt, sChar, &data[0]); },
+   []() { Snprintf("Values %d %u 0x%08X %c %p\r\n", sInt, uInt, uInt, sChar, static_cast<void *>(&data[0])); }},
+  {"width: %010d",
+   []() { text.printf(string<"Width %010d\r\n">, sInt); },
+   []() { scatter.printf(string<"Width %010d\r\n">, sInt); },
+   []() { text.record(string<"Width %010d\r\n">, sInt); },
+   []() { Snprintf("Width %010d\r\n", sInt); }},
+  {"time: %t",
+   []() { text.printf(string<"[%t] Time\r\n">, uLong); },
+   []() { scatter.printf(string<"[%t] Time\r\n">, uLong); },
+   []() { text.record(string<"[%t] Time\r\n">, uLong); },
+   []() { Snprintf("[%lu.%03lu] Time\r\n", uLong / 1000, uLong % 1000); }},
+  {"float: %.3f",
+   []() { text.printf(string<"Temp %.3f\r\n">, sFloat); },
+   []() { scatter.printf(string<"Temp %.3f\r\n">, sFloat); },
+   []() { text.record(string<"Temp %.3f\r\n">, sFloat); },
+   []() { Snprintf("Temp %.3f\r\n", static_cast<double>(sFloat)); }},
+  {"Q15: %.5q",
+   []() { text.printf(string<"Gain %.5q\r\n">, sQ15); },
+   []() { scatter.printf(string<"Gain %.5q\r\n">, sQ15); },
+   []() { text.record(string<"Gain %.5q\r\n">, sQ15); },
+   []() { Snprintf("Gain %.5f\r\n", sQ15 / 32768.0); }},
+  {"long literal, 1 arg",
+   []() { text.printf(string<"This is the long trace string that describes some event in details with only one value %u\r\n">, uInt); },
+   []() { scatter.printf(string<"This is the long trace string that describes some event in details with only one value %u\r\n">, uInt); },
+   []() { text.record(string<"This is the long trace string that describes some event in details with only one value %u\r\n">, uInt); },
+   []() { Snprintf("This is the long trace string that describes some event in details with only one value %u\r\n", uInt); }},
+  {"DataBuffer 16",
+   []() { text.printf(string<"Buffer [%u]:">, DataBuffer(data, 16), 16U); },
+   []() { scatter.printf(string<"Buffer [%u]:">, DataBuffer(data, 16), 16U); },
+   []() { text.record(string<"Buffer [%u]:">, DataBuffer(data, 16), 16U); },
+   []() { SnprintfBuffer(16); }},
+  {"DataBuffer 64",
+   []() { text.printf(string<"Buffer [%u]:">, DataBuffer(data, 64), 64U); },
+   []() { scatter.printf(string<"Buffer [%u]:">, DataBuffer(data, 64), 64U); },
+   []() { text.record(string<"Buffer [%u]:">, DataBuffer(data, 64), 64U); },
+   []() { SnprintfBuffer(64); }},
+  {"DataBuffer 256",
+   []() { text.printf(string<"Buffer [%u]:">, DataBuffer(data, 256), 256U); },
+   []() { scatter.printf(string<"Buffer [%u]:">, DataBuffer(data, 256), 256U); },
+   []() { text.record(string<"Buffer [%u]:">, DataBuffer(data, 256), 256U); },
+   []() { SnprintfBuffer(256); }},
+  {"Log.info 2 args",
+   []() { logText.info(string<"Dec %d and hex %X">, sInt, uInt); },
+   nullptr,
+   []() { logBinary.info(string<"Dec %d and hex %X">, sInt, uInt); },
+   []() { Snprintf("[%lu.%03lu] INFO BENCH: Dec %d and hex 0x%08X\r\n", writeOut.tick() / 1000, writeOut.tick() % 1000, sInt, uInt); }},
+};
+// clang-format on
+
+/**
+ * @brief         Measure the minimal quantity of cycles per call
+ *
+ * @param clock   Cycle counter
+ * @param func    Function to be measured
+ * @param repeat  Quantity of the measurements
+ * @param batch   Quantity of the calls in one measurement
+ * @return        Minimal quantity of cycles per call (without the measurement overhead)
+ */
+template <typename Clock> inline std::uint64_t Measure(const Clock &clock, void (*func)(), const unsigned repeat, const unsigned batch) {
+  if (nullptr == func) {
+    return 0;
+  }
+  std::uint64_t overhead = ~0ULL;
+  std::uint64_t best = ~0ULL;
+  for (unsigned i = 0; i < repeat; i++) {
+    const auto start = clock();
+    const auto empty = clock();
+    for (unsigned j = 0; j < batch; j++) {
+      func();
+    }
+    const auto stop = clock();
+    overhead = ((empty - start) < overhead) ? (empty - start) : overhead;
+    best = ((stop - empty) < best) ? (stop - empty) : best;
+  }
+  return (best > overhead) ? ((best - overhead) / batch) : 0;
+}
+
+/**
+ * @brief         Run the whole corpus and pass the result of each case to the report
+ *
+ * @param report  Callable object report(const char *name, text, scatter, binary, snprintf) (cycles per call, 0 - not applicable)
+ * @param clock   Cycle counter (callable object that returns unsigned integral)
+ * @param repeat  Quantity of the measurements for each case (the minimum is reported)
+ * @param batch   Quantity of the calls in one measurement (1 is enough for DWT CYCCNT)
+ */
+template <typename Report, typename Clock>
+inline void run(const Report &report, const Clock &clock, const unsigned repeat = 1000, const unsigned batch = 16) {
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = static_cast<char>(i * 7);
+  }
+  for (const auto &c : corpus) {
+    report(c.name, Measure(clock, c.text, repeat, batch), Measure(clock, c.scatter, repeat, batch), Measure(clock, c.binary, repeat, batch),
+           Measure(clock, c.snprintf, repeat, batch));
+  }
+}
+
+#if !defined(__arm__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+// Overload with the default cycle counter
+template <typename Report> inline void run(const Report &report) { run(report, Cycles{}); }
+#endif
+
+} // namespace iso::bench
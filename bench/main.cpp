@@ -0,0 +1,39 @@
+/**
+ * @file    main.cpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   Host build of the benchmark (for the target call iso::bench::run() with own report)
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ */
+
+#include <cstdio>
+
+#include "benchmark.hpp"
+
+// Print the cell of the table ('-' - the backend is not applicable for the case)
+static void Cell(const unsigned long long cycles) {
+  if (cycles) {
+    std::printf(" %10llu", cycles);
+  } else {
+    std::printf(" %10s", "-");
+  }
+}
+
+int main() {
+  std::printf("%-28s %10s %10s %10s %10s %10s\r\n", "Case (cycles per call)", "text", "writev", "binary", "snprintf", "x text");
+  iso::bench::run([](const char *name, const auto text, const auto scatter, const auto binary, const auto snprintf) {
+    std::printf("%-28s", name);
+    Cell(text);
+    Cell(scatter);
+    Cell(binary);
+    Cell(snprintf);
+    std::printf(" %10.1f\r\n", text ? static_cast<double>(snprintf) / static_cast<double>(text) : 0.0);
+  });
+  return 0;
+}
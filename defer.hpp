@@ -0,0 +1,206 @@
+/**
+ * @file    defer.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The output that keeps only the arguments of the traces and formats them later (idle or low-priority task):
+ *          the call site copies the pointer to the formatter of the call site and the arguments into the ring buffer.
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+
+#include "log.hpp"
+#include "ring.hpp"
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief           Output with the deferred text formatting: the Log passes the kept arguments of the trace instead of the line,
+ *                  each record is [formatter of the call site][arguments] in the lock-free ring buffer (safe for the interrupts)
+ *                  drain() formats the records in its own context and passes the lines to the real output
+ *                  The run-time strings and the data of the DataBuffer are copied into the record (up to their max length)
+ *
+ * @tparam Output   The type that should be satisfied to iso::format::sink concept (real output - display, file, UART, et cetera)
+ * @tparam N        Size of the ring buffer in bytes (should be a power of 2)
+ * @tparam chunk    Size of the buffer on the stack of drain() for the long lines (0 - the buffer for the whole line)
+ * @tparam dump     Max length of the data of the DataBuffer (0 - no limit, only for the stage Output): the longer data is cut to it,
+ *                  the line with the data is passed to the Output at once (the same as iso::log::dump of the Log)
+ *
+ * @example         static iso::output::Defer<Display, 1024> deferred{display};
+ * @example         static constexpr iso::log::Log debug{deferred, iso::format::string<"ISR">};
+ * @example         deferred.drain(); // In the low-priority task
+ */
+template <iso::format::sink Output, const size_t N, const size_t chunk = 0, const size_t dump = 0> class Defer final {
+  using Format = iso::format::Format<Output, chunk, dump>;
+
+  // Formatter of the record: the kept arguments are formatted into the real output
+  using Replay = void (*)(const Defer &, const char *, size_t);
+
+  // Output of the ring buffer: the records are replayed in drain()
+  struct Player {
+    const Defer &defer; // Owner of the formatters
+    void write(const char *record, const size_t size) const {
+      Replay replay;
+      std::memcpy(&replay, record, sizeof(replay));
+      replay(defer, &record[sizeof(replay)], size - sizeof(replay));
+    }
+  };
+
+  const Output &out;          // Reference to the real Output object
+  const Format format;        // Format into the real output
+  const Player player;        // Output of the ring buffer
+  const Ring<Player, N> ring; // Records of the traces
+
+  // Formatter of the call site (one instantiation per prefix, string, end and the argument types)
+  template <typename P, typename E, typename S, const bool data, typename... Args> static void Formatted(const Defer &d, const char *kept, size_t) {
+    d.format.template replay<P, E, S, data, Args...>(kept);
+  }
+
+  // Pass the raw data to the real output (written directly to the Defer): write(), writev() or puts() by the pieces
+  static void Raw(const Defer &d, const char *data, const size_t size) { iso::format::pass(d.out, data, size); }
+
+  // Place the record into the ring buffer: the formatter and the data that is copied by the callable
+  template <typename Keep> size_t place(const Replay replay, const size_t size, const Keep keep) const {
+    auto *data = ring.reserve(sizeof(replay) + size);
+    if (nullptr == data) {
+      return 0;
+    }
+    std::memcpy(data, &replay, sizeof(replay));
+    const auto length = sizeof(replay) + keep(&data[sizeof(replay)]);
+    ring.commit(data, length);
+    return length;
+  }
+
+public:
+  /**
+   * @brief   Constructor for the object (the ring buffer itself is constant-initialized)
+   *
+   * @param o Reference to the real Output object
+   */
+  consteval Defer(const Output &o) : out(o), format(o), player{*this}, ring(player) {}
+
+  /**
+   * @brief         Keep the arguments of the trace (needed for iso::log::deferred concept, safe to call from the interrupts and any thread)
+   *
+   * @param Frame   Prefix and end of the string
+   * @param str     Compile time string string with the specifiers to be formatted
+   * @param args    Variables that should be formatted in drain()
+   *
+   * @return        Size of the record, 0 - dropped (the buffer is full)
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  size_t defer(const iso::format::Frame<P, E>, const S, const Args... args) const {
+    return place(&Formatted<P, E, S, false, Args...>, Format::template kept<P, S, Args...>,
+                 [&](char *buffer) { return Format::keep(iso::format::Frame<P, E>{}, S{}, buffer, args...); });
+  }
+
+  /**
+   * @brief             Overload for the data buffers (the data is copied into the record)
+   *
+   * @return            Size of the record, 0 - dropped (the buffer is full)
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  size_t defer(const iso::format::Frame<P, E>, const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
+    static_assert(dump || iso::format::stage<Output>, "ERROR: The trace with the DataBuffer is one transaction of the Output only with the max length of the data (dump)!");
+    if (nullptr == dataBuffer.data) {
+      return 0;
+    }
+    if constexpr (dump) {
+      if (dataBuffer.length > dump) {
+        const size_t cut = dump;
+        return defer(iso::format::Frame<P, E>{}, S{}, iso::format::DataBuffer(dataBuffer.data, cut, dataBuffer.separator, dataBuffer.perLine), args...);
+      }
+    }
+    return place(&Formatted<P, E, S, true, Args...>, Format::template kept<P, S, Args...> + Format::dumped + dataBuffer.length,
+                 [&](char *buffer) { return Format::keep(iso::format::Frame<P, E>{}, S{}, buffer, dataBuffer, args...); });
+  }
+
+  /**
+   * @brief         Copy the data to the ring buffer as it is (it is passed to the real output in drain())
+   *
+   * @param buffer  Data to be copied
+   * @param length  Length of the data
+   * @return        True if the data has been copied, false - dropped (the buffer is full)
+   */
+  bool write(const char *buffer, const size_t length) const {
+    return !length || place(&Raw, length, [&](char *data) {
+      std::memcpy(data, buffer, length);
+      return length;
+    });
+  }
+
+  /**
+   * @brief     Copy the string to the ring buffer
+   *
+   * @param buf String to be copied
+   */
+  void puts(const char *buf) const { write(buf, std::strlen(buf)); }
+
+  /**
+   * @brief   Pass the time from the real Output (needed for iso::log::time concept)
+   *
+   * @return  Time from the real output
+   */
+  auto tick() const
+  requires iso::log::time_func<Output>
+  {
+    return out.tick();
+  }
+
+  /**
+   * @brief   Pass the cycle counter from the real Output (needed for iso::log::cycles)
+   *
+   * @return  Cycles from the real Output
+   */
+  auto cycles() const
+  requires iso::log::cycles_func<Output>
+  {
+    return out.cycles();
+  }
+
+  /**
+   * @brief   Format the kept traces and pass them to the real output (should be called from the only one context, for example idle task)
+   *
+   * @return  Quantity of the passed traces
+   */
+  size_t drain() const { return ring.drain(); }
+
+  /**
+   * @brief   Quantity of the traces that were dropped because the buffer was full
+   *
+   * @return  Quantity of the dropped traces
+   */
+  size_t dropped() const { return ring.dropped(); }
+};
+
+} // namespace iso::output
@@ -0,0 +1,320 @@
+/**
+ * @file    dma.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The double-buffered output for the UART/USART with DMA:
+ *          the lines are collected in one buffer while the other one is transmitted.
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+
+#include "log.hpp"
+#include "pingpong.hpp"
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief   Concept to check the provided type can start the DMA transmission: transmit(const char *, size_t) shouldn't block
+ *
+ * @tparam  T The type should be checked
+ */
+template <typename T>
+concept dma_driver = requires(const T &t, const char *data, const size_t length) {
+  { t.transmit(data, length) };
+};
+
+/**
+ * @brief           Lock-free double-buffered (ping-pong) output for the DMA: the formatter builds the line in place of the filled buffer
+ *                  (iso::format::stage concept), the other one is transmitted by the DMA at the same time.
+ *                  When both buffers are busy, the lines are queued in the filled buffer until it is full (then dropped)
+ *                  The unused rest of the reserved line is released if nothing has been reserved after it, otherwise it stays
+ *                  as the gap that is skipped by the transmission (the buffer is transmitted by parts, up to 8 gaps and
+ *                  preempted lines per buffer). write() copies the line with the known length, puts() is the slow fallback (strlen)
+ *                  done() should be called from the DMA transfer complete interrupt
+ *
+ * @tparam Driver   The type that should be satisfied to iso::output::dma_driver concept (HAL_UART_Transmit_DMA, et cetera)
+ * @tparam N        Size of each buffer in bytes
+ *
+ * @example         static iso::output::Dma<Uart, 256> uart{uartDriver};
+ * @example         static constexpr iso::log::Log debug{uart, iso::format::string<"MAIN">};
+ * @example         void HAL_UART_TxCpltCallback(UART_HandleTypeDef *) { uart.done(); }
+ */
+template <dma_driver Driver, const size_t N> class Dma final {
+  static_assert(N && (N < (1UL << 23)), "ERROR: The size of the DMA buffer should be less than 8 MiB!");
+
+  static constexpr unsigned quantity = 8;               // Slots of each buffer: the lines that are built in place and their gaps
+  static constexpr std::uint32_t building = 0x80000000UL; // The slot keeps the reservation of the line (the gap otherwise)
+
+  // Reserved place of the line that is built in place, or the gap that is left by it
+  struct Slot {
+    std::atomic<std::uint32_t> start; // Offset in the buffer
+    std::atomic<std::uint32_t> size;  // Length with the building flag (0 - the free slot)
+  };
+
+  const Driver &driver;                               // Reference to the DMA driver object
+  mutable char buffers[2][N]{};                       // The ping-pong buffers
+  const PingPong<N> states{};                         // States of the buffers
+  mutable Slot slots[2][quantity]{};                  // Slots of the buffers
+  mutable std::atomic<unsigned> used[2]{};            // Quantity of the taken slots of the buffers
+  mutable std::atomic<unsigned> sending{};            // Index of the buffer that is transmitted now
+  mutable std::atomic<bool> busy{};                   // The DMA is transmitting (or is being started)
+  mutable std::atomic<size_t> drops{};                // Quantity of the lines that were dropped (both buffers were full)
+  mutable size_t cursor{};                            // Position of the next part of the transmitted buffer (owned by the transmission)
+  mutable size_t total{};                             // Length of the transmitted buffer (owned by the transmission)
+
+  // Take the slot of the buffer (the buffer is reserved by the caller, so it isn't released meanwhile)
+  bool take(const unsigned index, unsigned &slot) const {
+    auto taken = used[index].load(std::memory_order_relaxed);
+    while (taken < quantity) {
+      if (used[index].compare_exchange_weak(taken, taken + 1, std::memory_order_relaxed)) {
+        slot = taken;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Free the slot (the last one is given back, the others stay empty till the buffer is released)
+  void leave(const unsigned index, const unsigned slot) const {
+    slots[index][slot].size.store(0, std::memory_order_relaxed);
+    auto taken = slot + 1;
+    used[index].compare_exchange_strong(taken, slot, std::memory_order_relaxed);
+  }
+
+  // Transmit the next part of the sealed buffer, the gaps are skipped (false - the whole buffer has been transmitted)
+  bool transmit() const {
+    const auto index = sending.load(std::memory_order_relaxed);
+    const auto taken = used[index].load(std::memory_order_relaxed);
+    auto end = total;
+    for (bool skipped = true; skipped;) {
+      skipped = false;
+      end = total;
+      for (unsigned slot = 0; slot < taken; slot++) {
+        const auto start = slots[index][slot].start.load(std::memory_order_relaxed);
+        const auto size = slots[index][slot].size.load(std::memory_order_relaxed);
+        if (size && (start == cursor)) {
+          cursor += size;
+          skipped = true;
+        } else if (size && (start > cursor) && (start < end)) {
+          end = start;
+        }
+      }
+    }
+    if (cursor >= total) {
+      return false;
+    }
+    const auto start = cursor;
+    cursor = end; // Before the start: the transfer complete interrupt might come at once
+    driver.transmit(&buffers[index][start], end - start);
+    return true;
+  }
+
+  // Release the transmitted buffer with its slots, the writers can use it again
+  void finish(const unsigned index) const {
+    used[index].store(0, std::memory_order_relaxed);
+    states.release(index);
+  }
+
+  // Seal the buffer with the lines and start the DMA, if it is idle and nobody is writing to the buffer
+  void kick() const {
+    while (!busy.exchange(true)) {
+      unsigned index = 0;
+      while (const auto size = states.seal(index)) {
+        sending.store(index, std::memory_order_relaxed);
+        cursor = 0;
+        total = size;
+        if (transmit()) {
+          return;
+        }
+        finish(index); // Only the gaps were in the buffer
+      }
+      busy.store(false);
+
+      // The last writer might have tried to start the DMA while it was busy
+      if (!states.pending()) {
+        return;
+      }
+    }
+  }
+
+public:
+  /**
+   * @brief   Constructor for the object (the buffers themselves are constant-initialized)
+   *
+   * @param d Reference to the DMA driver object
+   */
+  constexpr Dma(const Driver &d) : driver(d) {}
+
+  /**
+   * @brief         Reserve the place for the line in the filled buffer (safe to call from the interrupts and any thread)
+   *                The place is private for the caller until commit(), the DMA isn't started with it
+   *
+   * @param length  Max length of the line
+   * @return        Pointer to the reserved place, nullptr - dropped (both buffers are full or have no free slots)
+   */
+  char *reserve(const size_t length) const {
+    // The filled buffer is tried first, the other one - if the first has just been sealed
+    const auto first = states.current();
+    for (const auto index : {first, first ^ 1U}) {
+      size_t offset = 0;
+      if (!states.reserve(index, 0, offset)) {
+        continue; // Sealed
+      }
+
+      // The empty reservation keeps the buffer from the release while the slot is taken
+      unsigned slot = 0;
+      const bool taken = take(index, slot);
+      const bool reserved = taken && states.reserve(index, length, offset);
+      if (reserved) {
+        slots[index][slot].start.store(static_cast<std::uint32_t>(offset), std::memory_order_relaxed);
+        slots[index][slot].size.store(building | static_cast<std::uint32_t>(length), std::memory_order_release);
+      } else if (taken) {
+        leave(index, slot);
+      }
+      states.commit(index);
+      if (reserved) {
+        return &buffers[index][offset];
+      }
+      kick(); // The last writer might have tried to start the DMA while the buffer was reserved
+    }
+    drops.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  /**
+   * @brief         Commit the line that has been built in the reserved place and start the DMA if it is idle
+   *                (the unused rest is released if it is the last line, otherwise it is skipped by the transmission)
+   *
+   * @param data    Pointer that has been returned by reserve()
+   * @param length  Actual length of the line (not more than the reserved one)
+   */
+  void commit(char *data, const size_t length) const {
+    const unsigned index = (data < buffers[1]) ? 0 : 1;
+    const auto offset = static_cast<std::uint32_t>(data - buffers[index]);
+    for (unsigned slot = 0; slot < used[index].load(std::memory_order_relaxed); slot++) {
+      auto &place = slots[index][slot];
+      const auto size = place.size.load(std::memory_order_acquire);
+      if ((size & building) && (place.start.load(std::memory_order_relaxed) == offset)) {
+        const auto reserved = size & ~building;
+        if ((reserved > length) && !states.shrink(index, offset + reserved, reserved - length)) {
+          place.start.store(static_cast<std::uint32_t>(offset + length), std::memory_order_relaxed);
+          place.size.store(static_cast<std::uint32_t>(reserved - length), std::memory_order_relaxed);
+        } else {
+          leave(index, slot);
+        }
+        break;
+      }
+    }
+    states.commit(index);
+    kick();
+  }
+
+  /**
+   * @brief         Copy the line to the filled buffer and start the DMA if it is idle (safe to call from the interrupts and any thread)
+   *
+   * @param buffer  Line to be copied
+   * @param size    Length of the line
+   * @return        True if the line has been copied, false - dropped (both buffers are full)
+   */
+  bool write(const char *buffer, const size_t size) const {
+    if (0 == size) {
+      return true;
+    }
+
+    // The filled buffer is tried first, the other one - if the first has just been sealed
+    const auto first = states.current();
+    for (const auto index : {first, first ^ 1U}) {
+      size_t offset = 0;
+      if (states.reserve(index, size, offset)) {
+        std::memcpy(&buffers[index][offset], buffer, size);
+        states.commit(index);
+        kick();
+        return true;
+      }
+    }
+    drops.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  /**
+   * @brief     Copy the string to the filled buffer (the slow fallback: the length is calculated, reserve() and write() are preferred by the Format)
+   *
+   * @param buf String to be copied
+   */
+  void puts(const char *buf) const { write(buf, std::strlen(buf)); }
+
+  /**
+   * @brief   Pass the time from the DMA driver (needed for iso::log::time concept)
+   *
+   * @return  Time from the driver
+   */
+  auto tick() const
+  requires iso::log::time_func<Driver>
+  {
+    return driver.tick();
+  }
+
+  /**
+   * @brief   Pass the cycle counter from the DMA driver (needed for iso::log::cycles and Profile::Enabled)
+   *
+   * @return  Cycles from the DMA driver
+   */
+  auto cycles() const
+  requires iso::log::cycles_func<Driver>
+  {
+    return driver.cycles();
+  }
+
+  /**
+   * @brief   Release the transmitted buffer and start the next one (should be called from the DMA transfer complete interrupt)
+   */
+  void done() const {
+    if (transmit()) {
+      return; // The next part of the buffer (after the gap)
+    }
+    finish(sending.load(std::memory_order_relaxed));
+    busy.store(false);
+    kick();
+  }
+
+  /**
+   * @brief   Quantity of the lines that were dropped because both buffers were full
+   *
+   * @return  Quantity of the dropped lines
+   */
+  size_t dropped() const { return drops.load(std::memory_order_relaxed); }
+};
+
+} // namespace iso::output
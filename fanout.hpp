@@ -0,0 +1,178 @@
+/**
+ * @file    fanout.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The output that passes each trace to several outputs, each of them with its own level:
+ *          the trace is formatted once and the same line is passed to all outputs that accept its level.
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <tuple>
+
+#include "log.hpp"
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief         Output of the Fanout with its own level: the traces lower than the level are never passed to it (no code at all)
+ *
+ * @tparam Output The type that should be satisfied to iso::format::sink concept
+ * @tparam lvl    The lowest level of the traces for the output
+ */
+template <iso::format::sink Output, const iso::log::Trace lvl> struct Route {
+  static constexpr iso::log::Trace level = lvl;
+  const Output &out; // Reference to the Output object
+};
+
+/**
+ * @brief         Create the route with the level
+ *
+ * @tparam lvl    The lowest level of the traces for the output
+ * @param o       Reference to the Output object
+ * @return        Route object
+ *
+ * @example       iso::output::route<iso::log::Trace::Error>(uart)
+ */
+template <const iso::log::Trace lvl, iso::format::sink Output> consteval Route<Output, lvl> route(const Output &o) { return {o}; }
+
+/**
+ * @brief           Output that passes each trace to the outputs that accept its level: the Log formats the trace once
+ *                  (and reads tick() once) and the same line is passed to each of them (the text encoding only)
+ *                  tick() is taken from the first output
+ *
+ * @tparam Routes   Outputs with their levels (iso::output::Route)
+ *
+ * @example         static constexpr iso::output::Fanout fanout{iso::output::route<iso::log::Trace::Debug>(rtt), iso::output::route<iso::log::Trace::Error>(uart)};
+ * @example         static constexpr iso::log::Log debug{fanout, iso::log::log_lvl<iso::log::Trace::Debug>, iso::format::string<"MAIN">};
+ */
+template <typename... Routes> class Fanout final {
+  static_assert(sizeof...(Routes), "ERROR: The fan-out should have at least one output!");
+
+  using First = std::remove_cvref_t<decltype(std::declval<std::tuple_element_t<0, std::tuple<Routes...>>>().out)>;
+
+  const std::tuple<Routes...> routes; // Outputs with their levels
+
+  // Pass the data to the outputs that accept the level
+  template <const iso::log::Trace lvl> void deliver(const char *data, const size_t length) const {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+      (
+          [&] {
+            if constexpr (lvl >= std::tuple_element_t<I, std::tuple<Routes...>>::level) {
+              iso::format::pass(std::get<I>(routes).out, data, length);
+            }
+          }(),
+          ...);
+    }(std::index_sequence_for<Routes...>{});
+  }
+
+public:
+  /**
+   * @brief     Output of the Fanout for the traces of one level (the Log formats the traces of the level into it)
+   *
+   * @tparam l  Level of the traces
+   */
+  template <const iso::log::Trace l> class View final {
+    const Fanout &fanout; // Owner of the outputs
+
+  public:
+    constexpr View(const Fanout &f) : fanout(f) {}
+
+    void write(const char *data, const size_t length) const { fanout.template deliver<l>(data, length); }
+    void puts(const char *data) const { fanout.template deliver<l>(data, std::strlen(data)); }
+  };
+
+private:
+  // Views for all levels (they should live as long as the Fanout: the Log keeps the references to them)
+  const std::tuple<View<iso::log::Trace::Trace>, View<iso::log::Trace::Debug>, View<iso::log::Trace::Info>, View<iso::log::Trace::Warn>,
+                   View<iso::log::Trace::Error>, View<iso::log::Trace::Fatal>, View<iso::log::Trace::None>>
+      views;
+
+public:
+  /**
+   * @brief   Constructor for the object
+   *
+   * @param r Outputs with their levels (iso::output::route)
+   */
+  consteval Fanout(const Routes... r) : routes(r...), views(*this, *this, *this, *this, *this, *this, *this) {}
+
+  // At least one output accepts the level (the traces of the other levels are removed by the Log in the compile-time)
+  template <const iso::log::Trace lvl> static constexpr bool accepts = ((lvl >= Routes::level) || ...);
+
+  /**
+   * @brief   View for the traces of the level (needed for iso::log::routed concept)
+   *
+   * @tparam  lvl Level of the traces (from Trace::Trace to Trace::None)
+   * @return  Reference to the view
+   */
+  template <const iso::log::Trace lvl> constexpr const View<lvl> &view() const { return std::get<View<lvl>>(views); }
+
+  /**
+   * @brief         Pass the line to all outputs (the same as the Trace::None level)
+   *
+   * @param data    Line to be passed
+   * @param length  Length of the line
+   */
+  void write(const char *data, const size_t length) const { deliver<iso::log::Trace::None>(data, length); }
+
+  /**
+   * @brief     Pass the string to all outputs
+   *
+   * @param buf String to be passed
+   */
+  void puts(const char *buf) const { write(buf, std::strlen(buf)); }
+
+  /**
+   * @brief   Pass the time from the first output (needed for iso::log::time concept)
+   *
+   * @return  Time from the first output
+   */
+  auto tick() const
+  requires iso::log::time_func<First>
+  {
+    return std::get<0>(routes).out.tick();
+  }
+
+  /**
+   * @brief   Pass the cycle counter from the first output (needed for iso::log::cycles and Profile::Enabled)
+   *
+   * @return  Cycles from the first output
+   */
+  auto cycles() const
+  requires iso::log::cycles_func<First>
+  {
+    return std::get<0>(routes).out.cycles();
+  }
+};
+
+} // namespace iso::output
@@ -33,9 +33,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <bit>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <source_location>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 // C++ concepts should be enabled
 static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
@@ -53,6 +62,55 @@ concept put = requires(T &put, const char (&buff)[10]) {
   { put.puts(buff) };
 };
 
+/**
+ * @brief   Concept to check the provided type has write(const char *, size_t) method (for putting raw data with known length)
+ *
+ * @tparam  T The type should be checked
+ */
+template <typename T>
+concept write = requires(T &put, const char (&buff)[10], const size_t size) {
+  { put.write(buff, size) };
+};
+
+/**
+ * @brief Part of the result string for the scatter-gather output (points to the string literal or formatted field)
+ *
+ */
+struct Segment {
+  const char *data; // Pointer to the part of the string
+  size_t length;    // Length of the part
+};
+
+/**
+ * @brief   Concept to check the provided type has writev(const Segment *, size_t) method (for putting the string by parts without copying)
+ *
+ * @tparam  T The type should be checked
+ */
+template <typename T>
+concept gather = requires(T &put, const Segment (&segments)[2], const size_t quantity) {
+  { put.writev(segments, quantity) };
+};
+
+/**
+ * @brief   Concept to check the provided type can reserve the space for the whole line and commit it at once (lock-free staging)
+ *          reserve(size) returns the private contiguous space (nullptr - the line is dropped), commit(data, length) publishes it
+ *
+ * @tparam  T The type should be checked
+ */
+template <typename T>
+concept stage = requires(T &put, char *data, const size_t size) {
+  { put.reserve(size) } -> std::same_as<char *>;
+  { put.commit(data, size) };
+};
+
+/**
+ * @brief   Concept to check the provided type can be used as an output (write() is preferred, puts() is a fallback)
+ *
+ * @tparam  T The type should be checked
+ */
+template <typename T>
+concept sink = put<T> || write<T> || gather<T>;
+
 /**
  * @brief Concept to check that type is String
  *
@@ -143,6 +201,81 @@ template <const auto str> struct String {
    */
   template <const_string S> consteval auto operator+(const S) const { return String<instance + S::instance>{}; }
 };
+
+/**
+ * @brief Source location of the call site: the file name without the path and the line
+ *
+ */
+struct Place {
+  char file[32]; // File name (truncated to 31 characters)
+  unsigned line; // Line of the call site
+
+  consteval Place(const std::source_location location) : file(), line(static_cast<unsigned>(location.line())) {
+    const char *path = location.file_name();
+    size_t begin = 0;
+    for (size_t i = 0; path[i]; i++) {
+      if (('/' == path[i]) || ('\\' == path[i])) {
+        begin = i + 1;
+      }
+    }
+    for (size_t i = 0; (i < (sizeof(file) - 1)) && path[begin + i]; i++) {
+      file[i] = path[begin + i];
+    }
+  }
+
+  // Length of the "file:line" text
+  consteval size_t length() const {
+    size_t size = 0;
+    while (file[size]) {
+      size++;
+    }
+    for (unsigned rest = line; rest; rest /= 10) {
+      size++;
+    }
+    return size + 1 + (line ? 0 : 1);
+  }
+};
+
+/**
+ * @brief Struct that saves a string with the source location of the place where it is written (template argument of located)
+ */
+template <const size_t N> struct Site {
+  Wrap<N> text; // The string itself
+  Place place;  // Where the string is written (the default argument is taken at the call site)
+
+  consteval Site(const char (&s)[N], const std::source_location location = std::source_location::current()) : text(s), place(location) {}
+};
+// Deduction guide for the Site
+template <const size_t N> Site(char const (&)[N]) -> Site<N>;
+
+/**
+ * @brief     Compile-time "file:line" of the source location
+ *
+ * @tparam p  Source location
+ * @return    Wrap object with the text
+ */
+template <const Place p> consteval auto Where() {
+  char text[p.length() + 1]{};
+  size_t i = 0;
+  while (p.file[i]) {
+    text[i] = p.file[i];
+    i++;
+  }
+  text[i] = ':';
+  auto rest = p.line;
+  for (size_t position = p.length(); position > (i + 1); rest /= 10) {
+    text[--position] = static_cast<char>('0' + (rest % 10));
+  }
+  return Wrap<sizeof(text)>(text);
+}
+
+/**
+ * @brief String with the source location of the call site (the same as String for the formatting)
+ *        The binary descriptors contain the location, the text traces - only if it is requested by the Log
+ */
+template <const auto str, const Place where> struct Located : String<str> {
+  static constexpr Place location = where; // Source location of the call site
+};
 } // namespace wrappers
 
 /**
@@ -153,313 +286,1762 @@ template <const auto str> struct String {
 template <const wrappers::Wrap str> inline constexpr auto string = wrappers::String<str>{};
 
 /**
- * @brief Type that contains some dynamic buffer to print (with the specific overloading of printf)
+ * @brief   Inline variable to create strings with the source location where they are written
  *
+ * @example debug.error(located<"CRC mismatch %X">, crc); // main.cpp:42
  */
-struct DataBuffer {
-  const char *data;     // Pointer to the data
-  const size_t &length; // Length of the buffer
+template <const wrappers::Site site> inline constexpr auto located = wrappers::Located<site.text, site.place>{};
 
-  DataBuffer(const char *d, const size_t &l) : data(d), length(l) {}
-};
+// Checks that the string has the source location
+template <typename S>
+concept located_string = const_string<S> && requires(S) { S::location; };
 
 /**
- * @brief Consteval class that prints formatted strings
+ * @brief Compile-time descriptor of the binary record that is used instead of the string on the target
+ *        Layout: [quantity of fields][size of each field][string with specifiers and '\0']
+ *        The field size with the most significant bit set is a DataBuffer (lower bits - size of the length before data),
+ *        with 0x40 - a run-time string (lower bits - size of the length before characters),
+ *        with 0x20 - LEB128 (0x21 - zigzag, 0x30 | decimals - time difference, with 0x80 - the length of the DataBuffer)
+ *        The quantity with the most significant bit set is followed by "file:line" and '\0' after the string (located)
  *
- * @tparam Puts Type that fit into that put concept
+ * @tparam S      String type
+ * @tparam sizes  Sizes of the fields in the record
  */
-template <put Puts> class Format {
-  const Puts &puts; // Reference to the callback put object
+template <typename S, const unsigned char... sizes>
+requires const_string<S>
+struct Descriptor {
+  static_assert(sizeof...(sizes) < 0x80, "ERROR: The record can't have more than 127 fields!");
 
-  // Enumeration of the available specifiers
-  enum Specifier : char {
-    Unknown = 0,
+  // Source location after the string (nothing for the strings without the location)
+  static constexpr auto where = []() consteval {
+    if constexpr (located_string<S>) {
+      return wrappers::Where<S::location>();
+    } else {
+      return wrappers::Wrap<1>("");
+    }
+  }();
+  static constexpr size_t place = located_string<S> ? sizeof(where.elems) : 0;
 
-    SignedDecimalInteger = 'd',
-    UnsignedDecimalInteger = 'u',
-    UnsignedHexadecimalInteger = 'X',
-    Character = 'c',
-    StringOfCharacters = 's',
-    PointerAddress = 'p',
-    Time = 't',
-    Boolean = 'b'
+  struct Record {
+    char elems[1 + sizeof...(sizes) + sizeof(S::string) + place];
   };
 
-  // Array of the available specifiers
-  static constexpr Specifier specifiers[] = {Specifier::SignedDecimalInteger,
-                                             Specifier::UnsignedDecimalInteger,
-                                             Specifier::UnsignedHexadecimalInteger,
-                                             Specifier::Character,
-                                             Specifier::StringOfCharacters,
-                                             Specifier::PointerAddress,
-                                             Specifier::Time,
-                                             Specifier::Boolean};
-  /**
-   * @brief Inner structure of the specifier (inside provided string) properties
-   *
-   */
-  struct SpecifierData {
-    Specifier specifier; // The code of the specifier
-    unsigned width;      // For decimal with can be passed (example: %04u)
-    unsigned position;   // Position inside string array
-    unsigned size;       // The size in elements of the specifier (example: %d - 2, %06u - 4)
-
-    consteval SpecifierData() : specifier(), width(), position(), size() {}
-  };
+  // The descriptor itself is not needed on the target, so it is supposed to be placed into a non-loaded section
+  [[gnu::section(".iso_trace")]] static constexpr Record record = []() consteval {
+    Record r{};
+    const unsigned char fields[] = {static_cast<unsigned char>(sizeof...(sizes) | (place ? 0x80 : 0)), sizes...};
+    size_t i = 0;
+    for (const auto f : fields) {
+      r.elems[i++] = static_cast<char>(f);
+    }
+    for (const auto c : S::string) {
+      r.elems[i++] = c;
+    }
+    for (size_t j = 0; j < place; j++) {
+      r.elems[i++] = where.elems[j];
+    }
+    return r;
+  }();
 
   /**
-   * @brief   Inner class that contains SpecifierData for each specifier in the passed string
+   * @brief   ID of the record that is passed instead of the string (link-time address of the descriptor)
    *
-   * @tparam  N Quantity of specifiers in the string
+   * @return  Record ID
    */
-  template <const unsigned N> struct SpecifierTable {
-    SpecifierData data[N];
-    static constexpr auto size = N;
+  static inline std::uint32_t id() { return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&record)); }
+};
 
-    template <typename S>
-    requires const_string<S>
-    consteval SpecifierTable(const S) {
-      constexpr auto IsDigit = [=](const char sym) -> bool { return (('0' <= sym) && (sym <= '9')) ? true : false; };
+// Contains the conversion tables and functions that are shared between all Format objects
+namespace kernels {
+/**
+ * @brief Table to convert a byte to two hexadecimal characters (compile-time generated)
+ *
+ */
+struct HexTable {
+  char pairs[256][2];
 
-      unsigned pos = 0;
-      for (unsigned i = 0; i < sizeof(S::string); i++) {
-        if ('%' == S::string[i]) {
-          Specifier specifier = Specifier::Unknown;
-          unsigned width = 0;
-          unsigned position = i;
-          unsigned size = i;
-          while (IsDigit(S::string[++i])) {
-            if (('0' == S::string[i]) && (0 == width))
-              continue;
-            width = (10 * width) + (S::string[i] - '0');
-          }
-          char specInString = S::string[i];
-          for (const auto &s : specifiers) {
-            if (s == specInString) {
-              specifier = s;
-            }
-          }
-          data[pos].specifier = specifier;
-          data[pos].width = width;
-          data[pos].position = position;
-          data[pos].size = i - size + 1;
-          pos++;
-        }
-      }
+  consteval HexTable() : pairs() {
+    constexpr char digits[] = "0123456789ABCDEF";
+    for (unsigned i = 0; i < 256; i++) {
+      pairs[i][0] = digits[i >> 4];
+      pairs[i][1] = digits[i & 0xF];
     }
-  };
+  }
+};
+inline constexpr HexTable hex{};
 
-  /**
-   * @brief   Inner function that counts the specifiers quantity in the passed string
-   *
-   * @tparam  S string
-   * @return  Quantity of the specifiers
-   */
-  template <typename S>
-  requires const_string<S>
-  static consteval unsigned SpecifierQuantity(const S) {
-    unsigned quantity = 0;
-    for (const auto &s : S::string) {
-      if ('%' == s) {
-        quantity++;
-      }
+/**
+ * @brief Table to convert a number from 0 to 99 to two decimal characters (compile-time generated)
+ *
+ */
+struct DecimalTable {
+  char pairs[100][2];
+
+  consteval DecimalTable() : pairs() {
+    for (unsigned i = 0; i < 100; i++) {
+      pairs[i][0] = static_cast<char>('0' + (i / 10));
+      pairs[i][1] = static_cast<char>('0' + (i % 10));
     }
-    return quantity;
   }
+};
+inline constexpr DecimalTable decimals{};
 
-  // Transform width of the specifier to the type property
-  template <const unsigned w> struct Width {
-    static constexpr unsigned width = w;
-  };
-
-  /**
-   * @brief   Inner templates that check and format the specifiers according to the passed string
-   *
-   * @tparam  sp Specifier
-   * @tparam  Type Passed type
-   */
-  template <const Specifier sp, typename Type> struct SpecCheck {
-    static constexpr auto valid = false; // Compile time checking for the validity of passed type according to the passed specifier
-    static constexpr auto length = 0UL;  // Max expected length
-    /**
-     * @brief         Formats args for the string in run-time
-     *
-     * @tparam        W Width as a type property
-     * @param buffer  Current buffer position in the result string
-     * @param arg     Current argument
-     * @return        Length of the result of the format
-     */
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W);
-  };
+// Cortex-M0/M0+ (ARMv6-M) don't have the hardware divider, so the division is replaced by the reciprocal multiplication
+#if defined(__arm__) && !defined(__ARM_FEATURE_IDIV)
+inline constexpr bool divider = false;
+#else
+inline constexpr bool divider = true;
+#endif
 
-  // Overload for the signed decimals
-  template <typename Type> struct SpecCheck<Specifier::SignedDecimalInteger, Type> {
-    static constexpr auto valid = std::is_signed_v<Type> && std::is_integral_v<Type>;
-    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2) + 1;
-    static_assert(valid, "ERROR: The '%d' specifier supports only signed integrals!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      size_t num = 0;
-      auto uArg = (arg < 0) ? -arg : arg;
-      do {
-        const unsigned char val = static_cast<unsigned char>(uArg % 10);
-        buffer[num++] = val + '0';
-      } while (uArg /= 10);
-
-      if constexpr (W::width) {
-        while (num < W::width) {
-          buffer[num++] = '0';
-        }
-      }
+// The unsigned type that is used for the conversion (at least 32 bits)
+template <typename T> using Unsigned = std::conditional_t<(sizeof(T) > sizeof(std::uint32_t)), std::uint64_t, std::uint32_t>;
 
-      if (arg < 0) {
-        buffer[num++] = '-';
-      }
+/**
+ * @brief         Copy the characters (memcpy in the run-time, the plain loop in the compile-time)
+ *
+ * @param buffer  Current buffer position in the result string
+ * @param source  Characters to be copied
+ * @param length  Quantity of the characters
+ */
+constexpr void Copy(char *buffer, const char *source, const size_t length) {
+  if (std::is_constant_evaluated()) {
+    for (size_t i = 0; i < length; i++) {
+      buffer[i] = source[i];
+    }
+  } else {
+    std::memcpy(buffer, source, length);
+  }
+}
 
-      char swap;
-      for (size_t i = 0; i < num / 2; i++) {
-        swap = buffer[i];
-        buffer[i] = buffer[num - i - 1];
-        buffer[num - i - 1] = swap;
-      }
+/**
+ * @brief       Division by 100
+ *
+ * @param value Dividend
+ * @return      Quotient
+ */
+template <typename U> constexpr U Divide100(const U value) {
+  if constexpr (!divider && (sizeof(U) <= sizeof(std::uint32_t))) {
+    return static_cast<U>((static_cast<std::uint64_t>(value) * 0x51EB851FULL) >> 37); // Exact for all 32-bit values
+  } else {
+    return value / 100;
+  }
+}
 
-      return num;
-    }
-  };
+/**
+ * @brief   High half of the 64x64-bit product (by the 32-bit parts on the cores without the 128-bit type)
+ *
+ * @param a First multiplier
+ * @param b Second multiplier
+ * @return  Upper 64 bits of the product
+ */
+constexpr std::uint64_t MultiplyHigh(const std::uint64_t a, const std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using Wide = unsigned __int128;
+  return static_cast<std::uint64_t>((static_cast<Wide>(a) * b) >> 64);
+#else
+  const std::uint64_t al = a & 0xFFFFFFFFULL, ah = a >> 32, bl = b & 0xFFFFFFFFULL, bh = b >> 32;
+  const std::uint64_t low = al * bl, first = ah * bl, second = al * bh;
+  const std::uint64_t middle = (low >> 32) + (first & 0xFFFFFFFFULL) + (second & 0xFFFFFFFFULL);
+  return (ah * bh) + (first >> 32) + (second >> 32) + (middle >> 32);
+#endif
+}
 
-  // Overload for the unsigned decimals
-  template <typename Type> struct SpecCheck<Specifier::UnsignedDecimalInteger, Type> {
-    static constexpr auto valid = std::is_unsigned_v<Type> && std::is_integral_v<Type>;
-    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2);
-    static_assert(valid, "ERROR: The '%u' specifier supports only unsigned integrals!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      size_t num = 0;
-      do {
-        const unsigned char val = static_cast<unsigned char>(arg % 10);
-        buffer[num++] = val + '0';
-      } while (arg /= 10);
-
-      if constexpr (W::width) {
-        while (num < W::width) {
-          buffer[num++] = '0';
-        }
-      }
+/**
+ * @brief       Division by 1000 (the reciprocal multiplication for the 64-bit values and the cores without the hardware divider)
+ *
+ * @param value Dividend
+ * @return      Quotient
+ */
+template <typename U> constexpr U Divide1000(const U value) {
+  if constexpr (sizeof(U) > sizeof(std::uint32_t)) {
+    return static_cast<U>(MultiplyHigh(value >> 3, 0x20C49BA5E353F7CFULL) >> 4); // Exact for all 64-bit values
+  } else if constexpr (!divider) {
+    return static_cast<U>((static_cast<std::uint64_t>(value) * 0x10624DD3ULL) >> 38); // Exact for all 32-bit values
+  } else {
+    return value / 1000;
+  }
+}
 
-      char swap;
-      for (size_t i = 0; i < num / 2; i++) {
-        swap = buffer[i];
-        buffer[i] = buffer[num - i - 1];
-        buffer[num - i - 1] = swap;
-      }
+/**
+ * @brief       Division of the 64-bit value by 10^9 by the reciprocal multiplication (no __aeabi_uldivmod on the 32-bit cores)
+ *
+ * @param value Dividend
+ * @param rest  Remainder (less than 10^9)
+ * @return      Quotient
+ */
+constexpr std::uint64_t Split(const std::uint64_t value, std::uint32_t &rest) {
+  const std::uint64_t quotient = MultiplyHigh(value >> 9, 0x44B82FA09B5A53ULL) >> 11; // Exact for all 64-bit values (10^9 = 2^9 * 5^9)
+  rest = static_cast<std::uint32_t>(value) - (static_cast<std::uint32_t>(quotient) * 1000000000UL);
+  return quotient;
+}
 
-      return num;
-    }
-  };
+/**
+ * @brief       Quantity of the decimal digits in the number
+ *
+ * @param value Number
+ * @return      Quantity of the digits
+ */
+template <typename U> constexpr unsigned Digits(const U value) {
+  constexpr unsigned max = (sizeof(U) > sizeof(std::uint32_t)) ? 20 : 10;
+  unsigned digits = 1;
+  U power = 10;
+  while ((digits < max) && (value >= power)) {
+    digits++;
+    power *= 10;
+  }
+  return digits;
+}
 
-  // Overload for the unsigned hexadecimals
-  template <typename Type> struct SpecCheck<Specifier::UnsignedHexadecimalInteger, Type> {
-    static constexpr auto valid = std::is_unsigned_v<Type> && std::is_integral_v<Type>;
-    static constexpr auto length = 2 * sizeof(Type) + 2;
-    static_assert(valid, "ERROR: The '%X' specifier supports only unsigned integrals!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      buffer[0] = '0';
-      buffer[1] = 'x';
-      for (size_t i = 2; i < length; i++) {
-        const unsigned char val = (arg >> ((8 * sizeof(Type)) - ((i - 1) * 4))) & 0xF;
-        buffer[i] = (val < 0xA) ? val + '0' : val + ('A' - 0xA);
+/**
+ * @brief         Convert the unsigned number to the decimal string, two digits per step from the end of the result
+ *
+ * @tparam width  Minimal quantity of the digits (filled by '0')
+ * @param buffer  Current buffer position in the result string
+ * @param value   Number
+ * @return        Length of the result
+ */
+template <const unsigned width, typename U> constexpr size_t Decimal(char *buffer, U value) {
+  // The 64-bit value is split by 10^9 into the 9-digit parts, so the digits are converted by the 32-bit steps only
+  if constexpr (sizeof(U) > sizeof(std::uint32_t)) {
+    if (value > 0xFFFFFFFFULL) {
+      std::uint32_t low = 0;
+      std::uint32_t middle = 0;
+      const auto high = Split(Split(value, low), middle);
+      size_t length = 0;
+      if (high) {
+        length = Decimal<((width > 18) ? (width - 18) : 0)>(buffer, static_cast<std::uint32_t>(high));
+        length += Decimal<9>(&buffer[length], middle);
+      } else {
+        length = Decimal<((width > 9) ? (width - 9) : 0)>(buffer, middle);
       }
-      return length;
-    }
-  };
-
-  // Overload for the unsigned characters
-  template <typename Type> struct SpecCheck<Specifier::Character, Type> {
-    static constexpr auto valid = std::is_same_v<char, std::remove_cv_t<Type>>;
-    static constexpr auto length = sizeof(char);
-    static_assert(valid, "ERROR: The '%c' specifier supports only (volatile/const) char)!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      buffer[0] = arg;
-      return length;
+      return length + Decimal<9>(&buffer[length], low);
     }
-  };
+    return Decimal<width>(buffer, static_cast<std::uint32_t>(value));
+  }
+  const unsigned digits = Digits(value);
+  const size_t length = (digits > width) ? digits : width;
+  size_t position = length;
+  while (value >= 100) {
+    const U quotient = Divide100(value);
+    const auto &pair = decimals.pairs[value - (quotient * 100)];
+    buffer[--position] = pair[1];
+    buffer[--position] = pair[0];
+    value = quotient;
+  }
+  if (value >= 10) {
+    const auto &pair = decimals.pairs[value];
+    buffer[--position] = pair[1];
+    buffer[--position] = pair[0];
+  } else {
+    buffer[--position] = static_cast<char>('0' + value);
+  }
+  while (position) {
+    buffer[--position] = '0';
+  }
+  return length;
+}
 
-  // Overload for the compile-time strings
-  template <typename Type> struct SpecCheck<Specifier::StringOfCharacters, Type> {
-    static constexpr auto valid = is_string_v<Type>;
-    static constexpr auto length = sizeof(Type::string) - 1;
-    static_assert(valid, "ERROR: The '%s' specifier supports only String!");
-    template <typename W> static size_t formatArg(char *buffer, Type, const W) {
-      for (size_t i = 0; i < length; i++) {
-        buffer[i] = Type::string[i];
-      }
-      return length;
+/**
+ * @brief         Convert the 32-bit value to 8 hexadecimal characters (SWAR: all nibbles at once in one 64-bit word, without branches)
+ *
+ * @tparam upper  Uppercase letters
+ * @param buffer  Current buffer position in the result string (8 characters)
+ * @param value   Number
+ */
+template <const bool upper> constexpr void Hex(char *buffer, const std::uint32_t value) {
+  std::uint64_t word = value;
+  word = (word | (word << 16)) & 0x0000FFFF0000FFFFULL;
+  word = (word | (word << 8)) & 0x00FF00FF00FF00FFULL;
+  word = (word | (word << 4)) & 0x0F0F0F0F0F0F0F0FULL; // The nibble i is in the byte i
+  const std::uint64_t letters = ((word + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL; // 1 in the bytes with nibble >= 0xA
+  word += 0x3030303030303030ULL + (letters * static_cast<unsigned char>((upper ? 'A' : 'a') - '0' - 0xA));
+  if (std::is_constant_evaluated()) {
+    for (unsigned i = 0; i < sizeof(word); i++) {
+      buffer[i] = static_cast<char>(word >> (8 * (sizeof(word) - 1 - i)));
     }
-  };
+    return;
+  }
+  if constexpr (std::endian::little == std::endian::native) {
+    word = __builtin_bswap64(word); // The most significant nibble is the first character
+  }
+  std::memcpy(buffer, &word, sizeof(word));
+}
 
-  // Overload for the pointer addresses
-  template <typename Type> struct SpecCheck<Specifier::PointerAddress, Type> {
-    static constexpr auto valid = std::is_pointer_v<Type>;
-    static constexpr auto length = 2 * sizeof(void *) + 2;
-    static_assert(valid, "ERROR: The '%p' specifier supports only pointers!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      buffer[0] = '0';
-      buffer[1] = 'x';
-      const size_t uArg = reinterpret_cast<size_t>(arg);
-      for (size_t i = 2; i < length; i++) {
-        const unsigned char val = (uArg >> ((8 * sizeof(void *)) - ((i - 1) * 4))) & 0xF;
-        buffer[i] = (val < 0xA) ? val + '0' : val + ('A' - 0xA);
+/**
+ * @brief         Convert the unsigned number to the hexadecimal string
+ *
+ * @tparam upper  Uppercase letters
+ * @tparam width  Minimal quantity of the digits (0 - all digits of the type, including leading zeros)
+ * @param buffer  Current buffer position in the result string
+ * @param value   Number
+ * @return        Length of the result
+ */
+template <const bool upper, const unsigned width, typename U> constexpr size_t Hexadecimal(char *buffer, const U value) {
+  constexpr size_t max = 2 * sizeof(U);
+  char digits[(sizeof(U) > sizeof(std::uint32_t)) ? 16 : 8];
+  if constexpr (sizeof(U) > sizeof(std::uint32_t)) {
+    Hex<upper>(digits, static_cast<std::uint32_t>(value >> 32));
+    Hex<upper>(&digits[8], static_cast<std::uint32_t>(value));
+  } else {
+    Hex<upper>(digits, value);
+  }
+  size_t length = max;
+  size_t zeros = 0;
+  if constexpr (width) {
+    const size_t significant = value ? ((std::bit_width(static_cast<Unsigned<U>>(value)) + 3) / 4) : 1;
+    length = (significant > width) ? significant : width;
+    if (length > max) {
+      zeros = length - max;
+      for (size_t i = 0; i < zeros; i++) {
+        buffer[i] = '0';
       }
-      return length;
     }
-  };
+  }
+  Copy(&buffer[zeros], &digits[sizeof(digits) - (length - zeros)], length - zeros);
+  return length;
+}
 
-  // Overload for the time (considered as time from launch)
-  template <typename Type> struct SpecCheck<Specifier::Time, Type> {
-    static constexpr auto valid = std::is_unsigned_v<Type> && std::is_integral_v<Type> && (sizeof(Type) >= sizeof(size_t));
-    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2) + 4;
-    static_assert(valid, "ERROR: The '%t' specifier supports only unsigned integrals with size >= unsigned long!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      auto num = SpecCheck<Specifier::UnsignedDecimalInteger, Type>::formatArg(buffer, arg / 1000, Width<0U>{});
-      buffer[num++] = '.';
-      num += SpecCheck<Specifier::UnsignedDecimalInteger, Type>::formatArg(&buffer[num], arg % 1000, Width<3U>{});
-      return num;
-    }
-  };
+// 10^precision for the digits after the point
+template <const unsigned precision> inline constexpr std::uint32_t Power10 = []() consteval {
+  std::uint32_t result = 1;
+  for (unsigned i = 0; i < precision; i++) {
+    result *= 10;
+  }
+  return result;
+}();
 
-  // Overload for the time booleans
-  template <typename Type> struct SpecCheck<Specifier::Boolean, Type> {
-    static constexpr auto valid = std::is_convertible_v<Type, bool>;
-    static constexpr auto length = sizeof("FALSE");
-    static_assert(valid, "ERROR: The '%b' specifier supports only types that can be convertible to bool!");
-    template <typename W> static size_t formatArg(char *buffer, Type arg, const W) {
-      const bool cond = (arg) ? 1 : 0;
-      const auto len = (cond ? sizeof("TRUE") : sizeof("FALSE")) - 1;
-      static constexpr char const *value[] = {{"FALSE"}, {"TRUE"}};
-      for (size_t i = 0; i < len; i++) {
-        buffer[i] = value[cond][i];
-      }
-      return len;
-    }
-  };
+/**
+ * @brief             Print the integer part and the digits after the point
+ *
+ * @tparam precision  Quantity of the digits after the point
+ * @param buffer      Current buffer position in the result string
+ * @param integer     Integer part of the number
+ * @param digits      Digits after the point (rounded, 10^precision is carried to the integer part)
+ * @return            Length of the result
+ */
+template <const unsigned precision, typename I> constexpr size_t Point(char *buffer, I integer, std::uint32_t digits) {
+  if (Power10<precision> == digits) {
+    digits = 0;
+    integer++;
+  }
+  auto length = Decimal<0>(buffer, integer);
+  if constexpr (precision) {
+    buffer[length++] = '.';
+    length += Decimal<precision>(&buffer[length], digits);
+  }
+  return length;
+}
 
-  // Check provided types according to the specifiers in the string, returns max possible length
-  template <const auto table, typename First, typename... Rest> static consteval size_t CheckSpecsTypes(const First, const Rest...) {
-    constexpr auto tableIndex = table.size - (sizeof...(Rest) + 1);
-    if constexpr (sizeof...(Rest)) {
-      return CheckSpecsTypes<table>(Rest{}...) + SpecCheck<table.data[tableIndex].specifier, First>::length;
-    }
-    return SpecCheck<table.data[tableIndex].specifier, First>::length;
+/**
+ * @brief             Convert the binary fixed-point number to the decimal one (integer only: each digit of the fraction
+ *                    is taken by the multiplication by 10, the last one is rounded to the nearest even as printf does)
+ *
+ * @tparam precision  Quantity of the digits after the point
+ * @param buffer      Current buffer position in the result string
+ * @param integer     Integer part of the number
+ * @param fraction    Fraction part of the number (should be less than 2^shift, shift + 4 bits should fit into the type)
+ * @param shift       Quantity of the fraction bits
+ * @return            Length of the result
+ */
+template <const unsigned precision, typename I, typename F> constexpr size_t Fraction(char *buffer, const I integer, F fraction, const unsigned shift) {
+  static_assert(precision <= 9, "ERROR: The precision should be less than 10 digits!");
+  const F mask = (F{1} << shift) - 1;
+  std::uint32_t digits = 0;
+  for (unsigned i = 0; i < precision; i++) {
+    fraction *= 10;
+    digits = (10 * digits) + static_cast<std::uint32_t>(fraction >> shift);
+    fraction &= mask;
   }
 
-public:
-  /**
-   * @brief Consteval constructor for the object
-   *
-   * @param p reference to the Puts object (with callback function to some output (Debugger, UART, USB, et cetera))
-   */
-  consteval Format(const Puts &p) : puts(p) {}
+  // The rest of the fraction is compared with the half of the last digit
+  const F half = (F{1} << shift) >> 1;
+  const bool odd = precision ? (digits & 1) : (integer & 1);
+  const bool up = shift && ((fraction > half) || ((fraction == half) && odd));
+  return precision ? Point<precision>(buffer, integer, digits + up) : Point<precision>(buffer, integer + up, 0);
+}
+
+/**
+ * @brief             Convert the floating-point number to the decimal string without the floating-point operations:
+ *                    the mantissa is converted as the fixed-point number with the shift of the exponent
+ *                    The finite numbers that are not less than 2^64 are converted to "overflow" ("inf" and "nan" are only IEEE ones)
+ *
+ * @tparam precision  Quantity of the digits after the point
+ * @param buffer      Current buffer position in the result string
+ * @param value       Number (float or double)
+ * @return            Length of the result
+ */
+template <const unsigned precision, typename T> constexpr size_t Floating(char *buffer, const T value) {
+  using Bits = std::conditional_t<(sizeof(T) > sizeof(std::uint32_t)), std::uint64_t, std::uint32_t>;
+  constexpr unsigned mantissa = (sizeof(T) > sizeof(std::uint32_t)) ? 52 : 23;
+  constexpr unsigned exponents = (sizeof(T) > sizeof(std::uint32_t)) ? 0x7FF : 0xFF;
+  constexpr int bias = static_cast<int>(exponents / 2 + mantissa);
+  constexpr int limit = 60; // Max quantity of the fraction bits (the multiplication by 10 should fit into 64 bits)
+
+  const auto bits = std::bit_cast<Bits>(value);
+  size_t length = 0;
+  if (bits >> (8 * sizeof(Bits) - 1)) {
+    buffer[length++] = '-';
+  }
+  const auto exponent = static_cast<unsigned>(bits >> mantissa) & exponents;
+  std::uint64_t significand = bits & ((Bits{1} << mantissa) - 1);
+  if (exponents == exponent) {
+    Copy(&buffer[length], significand ? "nan" : "inf", 3);
+    return length + 3;
+  }
+  if (exponent) {
+    significand |= std::uint64_t{1} << mantissa;
+  }
+
+  const int shift = bias - static_cast<int>(exponent ? exponent : 1);
+  if (shift <= 0) {
+    if (-shift > static_cast<int>(63 - mantissa)) {
+      Copy(&buffer[length], "overflow", 8);
+      return length + 8;
+    }
+    return length + Point<precision>(&buffer[length], significand << -shift, 0);
+  }
+  if (shift <= limit) {
+    return length + Fraction<precision>(&buffer[length], significand >> shift, significand & ((std::uint64_t{1} << shift) - 1), shift);
+  }
+
+  // The small numbers (less than 2^-7): the exact product of the significand and 10^precision takes two words
+  const std::uint64_t low = (significand & 0xFFFFFFFFU) * Power10<precision>;
+  const std::uint64_t high = (significand >> 32) * Power10<precision>;
+  const std::uint64_t product[] = {low + (high << 32), (high >> 32) + ((low + (high << 32)) < low)};
+  const auto bit = [&](const unsigned n) -> std::uint64_t { return (n < 128) ? ((product[n / 64] >> (n % 64)) & 1) : 0; };
+  const auto word = [&](const unsigned n) -> std::uint64_t { // Bits of the product from n (n > 0)
+    return (n < 64) ? ((product[0] >> n) | (product[1] << (64 - n))) : ((n < 128) ? (product[1] >> (n - 64)) : 0);
+  };
+  const auto digits = static_cast<std::uint32_t>(word(static_cast<unsigned>(shift)));
+  const auto half = static_cast<unsigned>(shift - 1);
+  const bool rest = (half < 64) ? (product[0] & ((std::uint64_t{1} << half) - 1))
+                                : ((half < 128) && (product[0] || (product[1] & ((std::uint64_t{1} << (half - 64)) - 1))));
+  const bool up = bit(half) && (rest || (digits & 1));
+  return length + Point<precision>(&buffer[length], std::uint64_t{0}, digits + up);
+}
+
+/**
+ * @brief         Unsigned LEB128: 7 bits in each byte from the lowest ones, the highest bit is set if the next byte follows
+ *
+ * @param buffer  Buffer for the bytes (not less than (8 * sizeof(Type) + 6) / 7)
+ * @param value   Value to encode
+ * @return        Quantity of the bytes
+ */
+template <typename Type> inline size_t Varint(char *buffer, Type value) {
+  size_t length = 0;
+  while (value >= 0x80U) {
+    buffer[length++] = static_cast<char>(value | 0x80U);
+    value >>= 7;
+  }
+  buffer[length++] = static_cast<char>(value);
+  return length;
+}
+
+/**
+ * @brief       Zigzag of the signed value (0, -1, 1, -2 -> 0, 1, 2, 3): the small negative values take the few bytes of LEB128 too
+ *
+ * @param value Signed value
+ * @return      Unsigned value (at least 32 bits)
+ */
+template <typename Type> inline constexpr auto Zigzag(const Type value) {
+  using U = Unsigned<Type>;
+  return static_cast<U>((static_cast<U>(value) << 1) ^ ((value < 0) ? ~U{0} : U{0}));
+}
+} // namespace kernels
+
+/**
+ * @brief Type that contains some dynamic buffer to print (with the specific overloading of printf)
+ *
+ */
+struct DataBuffer {
+  const char *data;     // Pointer to the data
+  const size_t &length; // Length of the buffer
+  const char separator; // Symbol before each byte ('\0' - without separator)
+  const size_t perLine; // Quantity of bytes in one line (0 - the whole buffer in one line)
+
+  DataBuffer(const char *d, const size_t &l, const char s = ' ', const size_t p = 0) : data(d), length(l), separator(s), perLine(p) {}
+};
+
+/**
+ * @brief           Time mark in 10^-decimals of the second (formatted by the '%t' specifier as the seconds with the fraction)
+ *
+ * @tparam decimals Quantity of the digits after the point
+ */
+template <const unsigned char decimals> struct Timestamp {
+  const std::uint64_t value; // Quantity of the time units
+};
+
+/**
+ * @brief Time of the previous binary record of the output: the '%t' fields are passed as the difference with it
+ *        The absolute time is passed in the first record, after the drop, if the time goes back and in each sync-th record
+ *        (the decoder might start at any point). The concurrent records share it, so the record that is interrupted
+ *        between the time and the output might be decoded with the time of the interrupting one
+ */
+struct Timeline {
+  static constexpr std::uint32_t sync = 64; // Max quantity of the records with the difference after the absolute time
+
+  std::atomic<std::uint32_t> previous{};   // Lower 32 bits of the previous time
+  std::atomic<std::uint32_t> upper{};      // Upper 32 bits of the previous time
+  std::atomic<std::uint32_t> records{sync}; // Quantity of the records since the absolute time
+
+  /**
+   * @brief         Places the time into the binary record: LEB128 of (difference << 1) or (absolute << 1 | 1)
+   *
+   * @param buffer  Current buffer position in the record (10 bytes)
+   * @param value   Time in the units of the record
+   * @return        Size of the time in the record
+   */
+  template <typename Type> size_t Pass(char *buffer, const Type value) {
+    const auto low = static_cast<std::uint32_t>(value);
+    const auto delta = low - previous.exchange(low, std::memory_order_relaxed);
+    bool absolute = (delta & 0x80000000UL) || (records.load(std::memory_order_relaxed) >= sync);
+    if constexpr (sizeof(Type) > sizeof(std::uint32_t)) {
+      const auto high = static_cast<std::uint32_t>(value >> 32);
+      absolute = (high != upper.exchange(high, std::memory_order_relaxed)) || absolute;
+    }
+    if (absolute) {
+      records.store(0, std::memory_order_relaxed);
+      return kernels::Varint(buffer, (static_cast<std::uint64_t>(value) << 1) | 1U);
+    }
+    records.store(records.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return kernels::Varint(buffer, delta << 1);
+  }
+
+  // The next record passes the absolute time (the previous one has been dropped)
+  void lost() { records.store(sync, std::memory_order_relaxed); }
+};
+
+// Output that is wrapped by the type (the wrappers that pass everything to the output, for example iso::log::Probe, define it)
+template <typename T> struct Unwrap {
+  using type = T;
+};
+template <typename T>
+requires requires { typename T::Wrapped; }
+struct Unwrap<T> {
+  using type = typename Unwrap<typename T::Wrapped>::type;
+};
+
+// Timeline of the output: all binary records of the output share it (the wrappers of the output too)
+template <typename Output> inline Timeline timeline{};
+
+/**
+ * @brief   Literals around the formatted string that are shared by all call sites (each literal is placed only once in the memory)
+ *
+ * @tparam P Prefix (might have specifiers, the first arguments are formatted into the prefix)
+ * @tparam E End (without specifiers)
+ */
+template <const_string P, const_string E> struct Frame {};
+
+// Inline variable to use outside
+template <const_string P, const_string E> inline constexpr auto frame = Frame<P, E>{};
+
+/**
+ * @brief     Formatted string in the array on the stack (the result of format_to without the buffer)
+ *
+ * @tparam N  Size of the array (the worst-case length of the string with '\0')
+ */
+template <const size_t N> struct Line {
+  char data[N];  // The formatted string with '\0'
+  size_t length; // Length of the string (without '\0')
+};
+
+/**
+ * @brief           Fixed-point number with the provided quantity of the fraction bits (formatted by the '%q' specifier)
+ *                  The plain int8_t, int16_t and int32_t are formatted as Q7, Q15 and Q31 without the wrapper
+ *
+ * @tparam fraction Quantity of the fraction bits
+ * @tparam T        Integral type of the raw value
+ */
+template <const unsigned char fraction, std::integral T> struct Fixed {
+  static_assert((fraction < (8 * sizeof(T))) && (fraction <= 60), "ERROR: The fraction should be less than the size of the type (and 60 bits)!");
+  const T value; // Raw value
+};
+
+/**
+ * @brief       Run-time string with the compile-time max length (formatted by the '%s' specifier, the longer strings are truncated)
+ *              The const char * can be also passed directly with the max length in the precision (%.16s)
+ *
+ * @tparam max  Max length of the string (the budget of the field)
+ */
+template <const size_t max> struct Text {
+  static_assert(max && (max <= 0xFFFF), "ERROR: The run-time string needs the max length (up to 65535): %.16s or iso::format::Text<16>!");
+  const char *data; // Pointer to the characters (the '\0' at the end is not needed if the length is provided)
+  const size_t length;
+
+  // The length is taken up to '\0', but not more than max
+  static constexpr size_t Length(const char *d) {
+    size_t l = 0;
+    while ((l < max) && d[l]) {
+      l++;
+    }
+    return l;
+  }
+
+  constexpr Text() : data(""), length(0) {}
+  constexpr Text(const char *d, const size_t l) : data(d), length((l < max) ? l : max) {}
+  constexpr Text(const char *d) : data(d), length(Length(d)) {}
+  constexpr Text(const std::string_view s) : Text(s.data(), s.size()) {}
+};
+
+// Checks that the argument is Text
+template <typename T> inline constexpr bool is_text_v = false;
+template <const size_t max> inline constexpr bool is_text_v<Text<max>> = true;
+
+/**
+ * @brief     Argument that is known in the compile-time: the string with the only constant (and compile-time string) arguments
+ *            is formatted in the compile-time and passed as one literal (nothing is formatted in the run-time)
+ *
+ * @tparam v  Value of the argument (integral, char, bool, float, double, Fixed, Timestamp)
+ */
+template <const auto v> struct Constant {
+  using Type = decltype(v);
+  static constexpr Type value = v;
+};
+
+// Inline variable to use outside
+template <const auto v> inline constexpr auto constant = Constant<v>{};
+
+// Checks that the argument is Constant
+template <typename T> inline constexpr bool is_constant_v = false;
+template <const auto v> inline constexpr bool is_constant_v<Constant<v>> = true;
+
+// Checks that all arguments are known in the compile-time (at least one Constant, the rest - compile-time strings)
+template <typename... Args> inline constexpr bool is_folded_v = (is_constant_v<Args> || ...) && ((is_constant_v<Args> || is_string_v<Args>) && ...);
+
+// Compile-time parser of the strings: the tables don't depend on the output, so they are evaluated once per string for all call sites
+namespace parser {
+// Enumeration of the available specifiers
+enum Specifier : char {
+  Unknown = 0,
+
+  SignedDecimalInteger = 'd',
+  UnsignedDecimalInteger = 'u',
+  UnsignedHexadecimalInteger = 'X',
+  UnsignedHexadecimalIntegerLowercase = 'x',
+  Character = 'c',
+  StringOfCharacters = 's',
+  PointerAddress = 'p',
+  Time = 't',
+  Boolean = 'b',
+  FloatingPoint = 'f',
+  FixedPoint = 'q'
+};
+
+// Specifier of the symbol after '%' (Unknown - the symbol isn't a specifier)
+consteval Specifier Classify(const char symbol) {
+  switch (symbol) {
+  case Specifier::SignedDecimalInteger:
+  case Specifier::UnsignedDecimalInteger:
+  case Specifier::UnsignedHexadecimalInteger:
+  case Specifier::UnsignedHexadecimalIntegerLowercase:
+  case Specifier::Character:
+  case Specifier::StringOfCharacters:
+  case Specifier::PointerAddress:
+  case Specifier::Time:
+  case Specifier::Boolean:
+  case Specifier::FloatingPoint:
+  case Specifier::FixedPoint:
+    return static_cast<Specifier>(symbol);
+  default:
+    return Specifier::Unknown;
+  }
+}
+
+/**
+ * @brief Structure of the specifier (inside provided string) properties
+ *
+ */
+struct SpecifierData {
+  Specifier specifier; // The code of the specifier
+  unsigned width;      // For decimal with can be passed (example: %04u)
+  bool bare;           // For hexadecimal the '#' flag drops the "0x" prefix (example: %#X)
+  unsigned precision;  // For fractional the digits after the point (example: %.3f, 6 by default), for strings - max length
+  bool point;          // The precision is provided
+  unsigned position;   // Position inside string array
+  unsigned size;       // The size in elements of the specifier (example: %d - 2, %06u - 4)
+
+  consteval SpecifierData() : specifier(), width(), bare(), precision(), point(), position(), size() {}
+};
+
+/**
+ * @brief   Class that contains SpecifierData for each specifier in the passed string (one pass over the string)
+ *          The constructor depends only on the sizes, so it is shared by all strings with the same length and quantity of the specifiers
+ *
+ * @tparam  N Quantity of specifiers in the string
+ */
+template <const unsigned N> struct SpecifierTable {
+  SpecifierData data[N];
+  static constexpr auto size = N;
+
+  template <const size_t M> consteval SpecifierTable(const char (&string)[M]) {
+    constexpr auto IsDigit = [=](const char sym) -> bool { return (('0' <= sym) && (sym <= '9')) ? true : false; };
+
+    unsigned pos = 0;
+    for (unsigned i = 0; i < M; i++) {
+      if ('%' == string[i]) {
+        unsigned width = 0;
+        unsigned position = i;
+        unsigned size = i;
+        const bool bare = ('#' == string[i + 1]);
+        if (bare) {
+          i++;
+        }
+        while (IsDigit(string[++i])) {
+          if (('0' == string[i]) && (0 == width))
+            continue;
+          width = (10 * width) + (string[i] - '0');
+        }
+        const bool point = ('.' == string[i]);
+        unsigned precision = 0;
+        if (point) {
+          while (IsDigit(string[++i])) {
+            precision = (10 * precision) + (string[i] - '0');
+          }
+        }
+        const auto specifier = Classify(string[i]);
+        data[pos].specifier = specifier;
+        data[pos].width = width;
+        data[pos].bare = bare;
+        const bool fractional = (Specifier::FloatingPoint == specifier) || (Specifier::FixedPoint == specifier);
+        data[pos].precision = (point || !fractional) ? precision : 6;
+        data[pos].point = point;
+        data[pos].position = position;
+        data[pos].size = i - size + 1;
+        pos++;
+      }
+    }
+  }
+};
+
+// Quantity of the specifiers in the string (shared by all strings with the same length)
+template <const size_t M> consteval unsigned Quantity(const char (&string)[M]) {
+  unsigned counter = 0;
+  for (const auto &s : string) {
+    if ('%' == s) {
+      counter++;
+    }
+  }
+  return counter;
+}
+
+// Check that the only decimals and hexadecimals in the table have a width, and the only hexadecimals and pointers have the '#' flag
+template <const unsigned N> consteval bool CheckWidth(const SpecifierTable<N> &table) {
+  for (const auto &d : table.data) {
+    const bool hex = (d.specifier == Specifier::UnsignedHexadecimalInteger) || (d.specifier == Specifier::UnsignedHexadecimalIntegerLowercase);
+    if (!hex && (d.specifier != Specifier::SignedDecimalInteger) && (d.specifier != Specifier::UnsignedDecimalInteger) && d.width) {
+      return false;
+    }
+    if (!hex && (d.specifier != Specifier::PointerAddress) && d.bare) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Check that the only fractional (not more than 9 digits) and strings in the table have a precision
+template <const unsigned N> consteval bool CheckPrecision(const SpecifierTable<N> &table) {
+  for (const auto &d : table.data) {
+    const bool fractional = (d.specifier == Specifier::FloatingPoint) || (d.specifier == Specifier::FixedPoint);
+    if ((fractional && (d.precision > 9)) || (!fractional && (d.specifier != Specifier::StringOfCharacters) && d.point)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Length of the literals of the string (without '\0' and the specifiers)
+template <const unsigned N> consteval size_t Literal(const SpecifierTable<N> &table, const size_t size) {
+  size_t length = size - 1;
+  for (const auto &d : table.data) {
+    length -= d.size;
+  }
+  return length;
+}
+
+// Quantity and table of the string (at least one element): evaluated once, shared by all outputs and argument types of the string
+template <typename S> inline constexpr unsigned quantity = Quantity(S::string);
+template <typename S> inline constexpr SpecifierTable<quantity<S> ? quantity<S> : 1> table{S::string};
+} // namespace parser
+
+/**
+ * @brief         Pass the data that is kept without '\0' (ring buffers, records) to the output: write() with the known length,
+ *                writev() with the one segment or puts() by the pieces on the stack
+ *
+ * @tparam piece  Size of the piece for the outputs that have only puts()
+ * @param out     Output object (with write(), writev() or puts())
+ * @param data    Data to be passed
+ * @param length  Length of the data
+ */
+template <const size_t piece = 64, typename Output> inline void pass(const Output &out, const char *data, const size_t length) {
+  if constexpr (write<Output>) {
+    out.write(data, length);
+  } else if constexpr (gather<Output>) {
+    const Segment segment[] = {{data, length}};
+    out.writev(segment, 1);
+  } else {
+    char buffer[piece + 1];
+    for (size_t i = 0; i < length;) {
+      const auto size = ((length - i) < piece) ? (length - i) : piece;
+      std::memcpy(buffer, &data[i], size);
+      buffer[size] = '\0';
+      out.puts(buffer);
+      i += size;
+    }
+  }
+}
+
+/**
+ * @brief Consteval class that prints formatted strings
+ *
+ * @tparam Puts   Type that fit into that sink concept
+ * @tparam chunk  Size of the buffer on the stack for the long strings (0 - the buffer for the whole string)
+ *                The strings longer than chunk are passed to the output by parts when chunk is full
+ *                (each formatted field should fit into the chunk: 11 bytes for %d of int32_t, 21 - for %d of int64_t)
+ * @tparam bound  Max length of the data of the DataBuffer (0 - no limit): the longer data is cut to it, the line with the data
+ *                is one transaction of any output (one writev() or one block of bound * 5 characters on the stack, the chunk isn't used),
+ *                without it the data is passed by the blocks after the line (the only stage outputs take the trace at once)
+ */
+template <sink Puts, const size_t chunk = 0, const size_t bound = 0> class Format {
+  const Puts &puts;                                                      // Reference to the callback put object
+  static constexpr size_t hexBlock = (chunk && (chunk < 64)) ? chunk : 64; // Size of the block for the data buffers conversion
+
+  using Specifier = parser::Specifier;
+  using SpecifierData = parser::SpecifierData;
+
+  /**
+   * @brief   Inner function that counts the specifiers quantity in the passed string
+   *
+   * @tparam  S string
+   * @return  Quantity of the specifiers
+   */
+  template <typename S>
+  requires const_string<S>
+  static consteval unsigned SpecifierQuantity(const S) {
+    return parser::quantity<S>;
+  }
+
+  // Transform width (the '#' flag and the precision) of the specifier to the type property
+  template <const unsigned w, const bool b = false, const unsigned p = 0> struct Width {
+    static constexpr unsigned width = w;
+    static constexpr bool bare = b;
+    static constexpr unsigned precision = p;
+  };
+
+  /**
+   * @brief   Inner template that places the argument into the binary record as it is in the memory
+   *
+   * @tparam  Type Passed type
+   */
+  template <typename Type> struct RawArg {
+    static constexpr unsigned char bytes = sizeof(Type);
+    static size_t encodeArg(char *buffer, Type arg) {
+      std::memcpy(buffer, &arg, bytes);
+      return bytes;
+    }
+  };
+
+  /**
+   * @brief   Inner template that places the integer into the binary record as LEB128 (the signed ones - after the zigzag)
+   *          The field size is 0x20 (0x21 - zigzag), the small counters and codes take 1 byte instead of the whole type
+   *
+   * @tparam  Type Passed type
+   */
+  template <typename Type> struct VarintArg {
+    static constexpr unsigned char bytes = 0x20 | (std::is_signed_v<Type> ? 0x01 : 0x00);
+    static constexpr size_t room = (8 * sizeof(Type) + 6) / 7; // Max size of the argument in the record
+    static size_t encodeArg(char *buffer, Type arg) {
+      if constexpr (std::is_signed_v<Type>) {
+        return kernels::Varint(buffer, kernels::Zigzag(arg));
+      } else {
+        return kernels::Varint(buffer, static_cast<kernels::Unsigned<Type>>(arg));
+      }
+    }
+  };
+
+  /**
+   * @brief       Inner template that places the time into the binary record as the difference with the previous record (Timeline)
+   *              The field size is 0x30 with the quantity of the digits after the point in the lower bits
+   *
+   * @tparam      decimals Quantity of the digits after the point
+   */
+  template <const unsigned char decimals> struct TimeArg {
+    static_assert(decimals < 0x10, "ERROR: The binary record supports the time with up to 15 digits after the point!");
+    static constexpr unsigned char bytes = 0x30 | decimals;
+    static constexpr size_t room = (8 * sizeof(std::uint64_t) + 6) / 7;
+    template <typename Type> static size_t Pass(char *buffer, const Type value) { return timeline<typename Unwrap<Puts>::type>.Pass(buffer, value); }
+  };
+
+  /**
+   * @brief   Inner templates that check and format the specifiers according to the passed string
+   *
+   * @tparam  sp Specifier
+   * @tparam  Type Passed type
+   */
+  template <const Specifier sp, typename Type> struct SpecCheck {
+    static constexpr auto valid = false; // Compile time checking for the validity of passed type according to the passed specifier
+    static constexpr auto length = 0UL;  // Max expected length
+    /**
+     * @brief         Formats args for the string in run-time
+     *
+     * @tparam        W Width as a type property
+     * @param buffer  Current buffer position in the result string
+     * @param arg     Current argument
+     * @return        Length of the result of the format
+     */
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W);
+
+    static constexpr unsigned char bytes = 0; // Size of the argument in the binary record
+    /**
+     * @brief         Places args into the binary record in run-time
+     *
+     * @param buffer  Current buffer position in the record
+     * @param arg     Current argument
+     * @return        Size of the argument in the record
+     */
+    static size_t encodeArg(char *buffer, Type arg);
+  };
+
+  // Overload for the signed decimals
+  template <typename Type> struct SpecCheck<Specifier::SignedDecimalInteger, Type> : VarintArg<Type> {
+    static constexpr auto valid = std::is_signed_v<Type> && std::is_integral_v<Type>;
+    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2) + 1;
+    static_assert(valid, "ERROR: The '%d' specifier supports only signed integrals!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      using U = kernels::Unsigned<Type>;
+      if (arg < 0) {
+        buffer[0] = '-';
+        return kernels::Decimal<W::width>(&buffer[1], static_cast<U>(U{0} - static_cast<U>(arg))) + 1;
+      }
+      return kernels::Decimal<W::width>(buffer, static_cast<U>(arg));
+    }
+  };
+
+  // Overload for the unsigned decimals
+  template <typename Type> struct SpecCheck<Specifier::UnsignedDecimalInteger, Type> : VarintArg<Type> {
+    static constexpr auto valid = std::is_unsigned_v<Type> && std::is_integral_v<Type>;
+    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2);
+    static_assert(valid, "ERROR: The '%u' specifier supports only unsigned integrals!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      return kernels::Decimal<W::width>(buffer, static_cast<kernels::Unsigned<Type>>(arg));
+    }
+  };
+
+  // Overload for the unsigned hexadecimals
+  template <typename Type, const bool upper> struct HexArg : RawArg<Type> {
+    static constexpr auto valid = std::is_unsigned_v<Type> && std::is_integral_v<Type>;
+    static constexpr auto length = 2 * sizeof(Type) + 2;
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      if constexpr (W::bare) {
+        return kernels::Hexadecimal<upper, W::width>(buffer, arg);
+      } else {
+        buffer[0] = '0';
+        buffer[1] = 'x';
+        return kernels::Hexadecimal<upper, W::width>(&buffer[2], arg) + 2;
+      }
+    }
+  };
+
+  template <typename Type> struct SpecCheck<Specifier::UnsignedHexadecimalInteger, Type> : HexArg<Type, true> {
+    static_assert(HexArg<Type, true>::valid, "ERROR: The '%X' specifier supports only unsigned integrals!");
+  };
+
+  // Overload for the unsigned hexadecimal integers in lowercase
+  template <typename Type> struct SpecCheck<Specifier::UnsignedHexadecimalIntegerLowercase, Type> : HexArg<Type, false> {
+    static_assert(HexArg<Type, false>::valid, "ERROR: The '%x' specifier supports only unsigned integrals!");
+  };
+
+  // Overload for the unsigned characters
+  template <typename Type> struct SpecCheck<Specifier::Character, Type> : RawArg<Type> {
+    static constexpr auto valid = std::is_same_v<char, std::remove_cv_t<Type>>;
+    static constexpr auto length = sizeof(char);
+    static_assert(valid, "ERROR: The '%c' specifier supports only (volatile/const) char)!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      buffer[0] = arg;
+      return length;
+    }
+  };
+
+  // Overload for the compile-time strings
+  template <typename Type> struct SpecCheck<Specifier::StringOfCharacters, Type> {
+    static constexpr auto valid = is_string_v<Type>;
+    static constexpr auto length = sizeof(Type::string) - 1;
+    static_assert(valid, "ERROR: The '%s' specifier supports only String, Text and const char * with the max length (%.16s)!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type, const W) {
+      for (size_t i = 0; i < length; i++) {
+        buffer[i] = Type::string[i];
+      }
+      return length;
+    }
+
+    // The strings are passed as they are by the scatter-gather and streamed outputs
+    template <typename W> static Segment view(Type, const W) { return {Type::string, length}; }
+
+    // The compile-time string is passed as the ID of its own descriptor
+    static constexpr unsigned char bytes = sizeof(std::uint32_t);
+    static size_t encodeArg(char *buffer, Type) {
+      const auto id = Descriptor<Type>::id();
+      std::memcpy(buffer, &id, bytes);
+      return bytes;
+    }
+  };
+
+  // Overload for the run-time strings with the compile-time max length
+  template <const size_t max> struct SpecCheck<Specifier::StringOfCharacters, Text<max>> {
+    static constexpr auto valid = true;
+    static constexpr auto length = max;
+    template <typename W> static constexpr size_t formatArg(char *buffer, const Text<max> arg, const W) {
+      kernels::Copy(buffer, arg.data, arg.length);
+      return arg.length;
+    }
+
+    template <typename W> static Segment view(const Text<max> arg, const W) { return {arg.data, arg.length}; }
+
+    // The characters are passed after the length: [length][characters] (the record has the variable size)
+    static constexpr unsigned char prefix = (max > 0xFF) ? sizeof(std::uint16_t) : sizeof(std::uint8_t);
+    static constexpr unsigned char bytes = 0x40 | prefix;
+    static constexpr size_t room = prefix + max; // Max size of the argument in the record
+    static size_t encodeArg(char *buffer, const Text<max> arg) {
+      if constexpr (sizeof(std::uint16_t) == prefix) {
+        const auto size = static_cast<std::uint16_t>(arg.length);
+        std::memcpy(buffer, &size, prefix);
+      } else {
+        buffer[0] = static_cast<char>(arg.length);
+      }
+      std::memcpy(&buffer[prefix], arg.data, arg.length);
+      return prefix + arg.length;
+    }
+  };
+
+  // Overload for the run-time strings with the max length in the precision (%.16s), the binary record is the same as for Text
+  template <typename Char> struct SpecCheck<Specifier::StringOfCharacters, Char *> {
+    using Type = Char *;
+    static constexpr auto valid = std::is_same_v<char, std::remove_cv_t<Char>>;
+    static constexpr auto length = 0UL; // The precision is added
+    static_assert(valid, "ERROR: The '%s' specifier supports only String, Text and const char * with the max length (%.16s)!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      return SpecCheck<Specifier::StringOfCharacters, Text<W::precision>>::formatArg(buffer, Text<W::precision>(arg), W{});
+    }
+
+    template <typename W> static Segment view(Type arg, const W) { return {arg, Text<W::precision>::Length(arg)}; }
+  };
+
+  // Overload for the pointer addresses
+  template <typename Type> struct SpecCheck<Specifier::PointerAddress, Type> : RawArg<Type> {
+    static constexpr auto valid = std::is_pointer_v<Type>;
+    static constexpr auto length = 2 * sizeof(void *) + 2;
+    static_assert(valid, "ERROR: The '%p' specifier supports only pointers!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      return HexArg<size_t, true>::formatArg(buffer, reinterpret_cast<size_t>(arg), W{});
+    }
+  };
+
+  // Overload for the time (considered as time from launch)
+  template <typename Type> struct SpecCheck<Specifier::Time, Type> : TimeArg<3> {
+    static constexpr auto valid = std::is_unsigned_v<Type> && std::is_integral_v<Type> && (sizeof(Type) >= sizeof(size_t));
+    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2) + 4;
+    static_assert(valid, "ERROR: The '%t' specifier supports only unsigned integrals with size >= unsigned long!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      const Type seconds = kernels::Divide1000(arg);
+      auto num = SpecCheck<Specifier::UnsignedDecimalInteger, Type>::formatArg(buffer, seconds, Width<0U>{});
+      buffer[num++] = '.';
+      num += SpecCheck<Specifier::UnsignedDecimalInteger, Type>::formatArg(&buffer[num], static_cast<Type>(arg - (seconds * 1000)), Width<3U>{});
+      return num;
+    }
+    static size_t encodeArg(char *buffer, Type arg) { return TimeArg<3>::Pass(buffer, arg); }
+  };
+
+  // Overload for the time with the provided resolution (the point is inserted into the digits, no division by the power of 10)
+  template <const unsigned char decimals> struct SpecCheck<Specifier::Time, Timestamp<decimals>> : TimeArg<decimals> {
+    static constexpr auto valid = true;
+    static constexpr auto length = 20 + 2;
+    template <typename W> static constexpr size_t formatArg(char *buffer, Timestamp<decimals> arg, const W) {
+      const auto num = kernels::Decimal<decimals + 1U>(buffer, arg.value);
+      for (size_t i = num; i > (num - decimals); i--) {
+        buffer[i] = buffer[i - 1];
+      }
+      buffer[num - decimals] = '.';
+      return num + 1;
+    }
+    static size_t encodeArg(char *buffer, Timestamp<decimals> arg) { return TimeArg<decimals>::Pass(buffer, arg.value); }
+  };
+
+  // Overload for the time booleans
+  template <typename Type> struct SpecCheck<Specifier::Boolean, Type> {
+    static constexpr auto valid = std::is_convertible_v<Type, bool>;
+    static constexpr auto length = sizeof("FALSE");
+    static_assert(valid, "ERROR: The '%b' specifier supports only types that can be convertible to bool!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      const bool cond = (arg) ? 1 : 0;
+      const auto len = (cond ? sizeof("TRUE") : sizeof("FALSE")) - 1;
+      constexpr char const *value[] = {{"FALSE"}, {"TRUE"}};
+      for (size_t i = 0; i < len; i++) {
+        buffer[i] = value[cond][i];
+      }
+      return len;
+    }
+
+    static constexpr unsigned char bytes = sizeof(bool);
+    static size_t encodeArg(char *buffer, Type arg) {
+      buffer[0] = (arg) ? 1 : 0;
+      return bytes;
+    }
+  };
+
+  // Overload for the floating-point numbers (only the integer operations are used for the conversion)
+  template <typename Type> struct SpecCheck<Specifier::FloatingPoint, Type> : RawArg<Type> {
+    static constexpr auto valid = std::is_same_v<float, Type> || std::is_same_v<double, Type>;
+    static constexpr auto length = 1 + 20 + 1; // Sign, integer part and point (the precision is added)
+    static_assert(valid, "ERROR: The '%f' specifier supports only float and double!");
+    static_assert(!valid || std::numeric_limits<Type>::is_iec559, "ERROR: The '%f' specifier supports only IEEE 754 types!");
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) { return kernels::Floating<W::precision>(buffer, arg); }
+  };
+
+  // Inner template of the fixed-point numbers with the provided quantity of the fraction bits
+  template <typename Type, const unsigned fraction> struct FixedArg {
+    static constexpr auto length = (3 * sizeof(Type)) - (sizeof(Type) / 2) + 2; // Sign, integer part and point (the precision is added)
+    template <typename W> static constexpr size_t formatArg(char *buffer, Type arg, const W) {
+      using U = kernels::Unsigned<Type>;
+      using F = std::conditional_t<(fraction > 28), std::uint64_t, std::uint32_t>; // The fraction is multiplied by 10
+      size_t length = 0;
+      auto value = static_cast<U>(arg);
+      if constexpr (std::is_signed_v<Type>) {
+        if (arg < 0) {
+          buffer[length++] = '-';
+          value = U{0} - value;
+        }
+      }
+      return length + kernels::Fraction<W::precision>(&buffer[length], value >> fraction, static_cast<F>(value & ((U{1} << fraction) - 1)), fraction);
+    }
+
+    // The quantity of the fraction bits is passed before the value: [fraction (0x80 - unsigned)][value]
+    static constexpr unsigned char bytes = 1 + sizeof(Type);
+    static size_t encodeArg(char *buffer, Type arg) {
+      buffer[0] = static_cast<char>(fraction | (std::is_signed_v<Type> ? 0 : 0x80));
+      std::memcpy(&buffer[1], &arg, sizeof(Type));
+      return bytes;
+    }
+  };
+
+  // Overload for the Q7, Q15 and Q31 (int8_t, int16_t, int32_t)
+  template <typename Type> struct SpecCheck<Specifier::FixedPoint, Type> : FixedArg<Type, ((8 * sizeof(Type)) - 1)> {
+    static constexpr auto valid =
+        std::is_same_v<std::int8_t, Type> || std::is_same_v<std::int16_t, Type> || std::is_same_v<std::int32_t, Type>;
+    static_assert(valid, "ERROR: The '%q' specifier supports only int8_t (Q7), int16_t (Q15), int32_t (Q31) and Fixed!");
+  };
+
+  // Overload for the fixed-point numbers with the provided quantity of the fraction bits
+  template <const unsigned char fraction, typename Type>
+  struct SpecCheck<Specifier::FixedPoint, Fixed<fraction, Type>> : FixedArg<Type, fraction> {
+    static constexpr auto valid = true;
+    template <typename W> static constexpr size_t formatArg(char *buffer, Fixed<fraction, Type> arg, const W) {
+      return FixedArg<Type, fraction>::formatArg(buffer, arg.value, W{});
+    }
+    static size_t encodeArg(char *buffer, Fixed<fraction, Type> arg) { return FixedArg<Type, fraction>::encodeArg(buffer, arg.value); }
+  };
+
+  // Max length of the field: the width might be bigger than the max length of the type (the sign is taken into account,
+  // the "0x" in front of the hexadecimal digits too), the digits after the point are added for the fractional
+  template <const SpecifierData data, typename Type> static consteval size_t FieldLength() {
+    const bool fractional = (Specifier::FloatingPoint == data.specifier) || (Specifier::FixedPoint == data.specifier);
+    const bool pointer = (Specifier::StringOfCharacters == data.specifier) && std::is_pointer_v<Type>;
+    const bool prefix = ((Specifier::UnsignedHexadecimalInteger == data.specifier) || (Specifier::UnsignedHexadecimalIntegerLowercase == data.specifier) ||
+                         (Specifier::PointerAddress == data.specifier)) &&
+                        !data.bare;
+    const size_t width = data.width ? (data.width + (prefix ? 2 : 1)) : 0;
+    const size_t length = SpecCheck<data.specifier, Type>::length + ((fractional || pointer) ? data.precision : 0);
+    return (length > width) ? length : width;
+  }
+
+  // Self-check of the budget: the max value is formatted into the buffer of exactly FieldLength bytes for the widths below,
+  // equal to and above the digits of the type (the write past the buffer isn't a constant expression)
+  static consteval SpecifierData HexField(const Specifier sp, const bool bare, const unsigned width) {
+    SpecifierData data;
+    data.specifier = sp;
+    data.width = width;
+    data.bare = bare;
+    return data;
+  }
+  template <typename Type, const Specifier sp, const bool bare, const unsigned width> static consteval bool HexFieldFits() {
+    char buffer[FieldLength<HexField(sp, bare, width), Type>()];
+    return SpecCheck<sp, Type>::formatArg(buffer, static_cast<Type>(~Type{}), Width<width, bare>{}) <= sizeof(buffer);
+  }
+  template <typename Type, const Specifier sp> static consteval bool HexFieldsFit() {
+    constexpr unsigned digits = 2 * sizeof(Type);
+    return HexFieldFits<Type, sp, false, 0>() && HexFieldFits<Type, sp, true, 0>() && HexFieldFits<Type, sp, false, digits - 1>() &&
+           HexFieldFits<Type, sp, true, digits - 1>() && HexFieldFits<Type, sp, false, digits>() && HexFieldFits<Type, sp, true, digits>() &&
+           HexFieldFits<Type, sp, false, digits + 4>() && HexFieldFits<Type, sp, true, digits + 4>();
+  }
+  static_assert(HexFieldsFit<std::uint8_t, Specifier::UnsignedHexadecimalInteger>() && HexFieldsFit<std::uint16_t, Specifier::UnsignedHexadecimalInteger>() &&
+                    HexFieldsFit<std::uint32_t, Specifier::UnsignedHexadecimalInteger>() && HexFieldsFit<std::uint64_t, Specifier::UnsignedHexadecimalInteger>() &&
+                    HexFieldsFit<std::uint64_t, Specifier::UnsignedHexadecimalIntegerLowercase>(),
+                "ERROR: The budget of the hexadecimal field is smaller than the formatted field!");
+
+  // Type of the argument in the binary record: the const char * is passed as Text with the max length from the precision
+  template <const Specifier sp, const unsigned precision, typename Type> struct Coding {
+    using type = Type;
+  };
+  template <const unsigned precision, typename Char> struct Coding<Specifier::StringOfCharacters, precision, Char *> {
+    using type = Text<precision>;
+  };
+  template <const Specifier sp, const unsigned precision, typename Type> using Coded = typename Coding<sp, precision, Type>::type;
+
+  // Max size of the argument in the binary record (the run-time strings have the variable size)
+  template <const SpecifierData data, typename Type> static consteval size_t RecordSize() {
+    using Check = SpecCheck<data.specifier, Coded<data.specifier, data.precision, Type>>;
+    if constexpr (requires { Check::room; }) {
+      return Check::room;
+    } else {
+      return Check::bytes;
+    }
+  }
+
+  // Check provided types according to the specifiers in the string, returns max possible length
+  template <const auto table, typename... Args> static consteval size_t CheckSpecsTypes() {
+    return []<size_t... I>(std::index_sequence<I...>) { return (FieldLength<table.data[I], std::remove_cv_t<Args>>() + ...); }(std::index_sequence_for<Args...>{});
+  }
+
+  /**
+   * @brief         Pass the string to the output, write() with the known length is used if it is provided
+   *
+   * @param buffer  String to be passed (should be finished with '\0' for the puts())
+   * @param length  Length of the string without '\0'
+   */
+  inline void pass(const char *buffer, const size_t length) const {
+    if constexpr (write<Puts>) {
+      puts.write(buffer, length);
+    } else if constexpr (put<Puts>) {
+      puts.puts(buffer);
+    } else {
+      const Segment segment[] = {{buffer, length}};
+      puts.writev(segment, 1);
+    }
+  }
+
+  /**
+   * @brief   Inner compile-time properties of the string with the passed argument types
+   *
+   * @tparam  S String type
+   * @tparam  Args Argument types
+   */
+  template <typename S, typename... Args> struct Layout {
+    static constexpr auto quantity = SpecifierQuantity(S{});
+    static_assert(sizeof...(Args) == quantity, "ERROR: The quantity of the specifiers in the string is not the same as the quantity of arguments!");
+    static_assert(!(is_constant_v<Args> || ...), "ERROR: The constant arguments can't be mixed with the run-time ones!");
+
+    static constexpr auto &table = parser::table<S>;
+    static_assert(parser::CheckWidth(table), "ERROR: The only decimals and hexadecimals allow to have a width (and '#' - the only hexadecimals and pointers)!");
+    static_assert(parser::CheckPrecision(table), "ERROR: The only '%f', '%q' (up to 9 digits) and '%s' allow to have a precision!");
+
+    // Max length of the formatted fields, length of the literals (without '\0') and quantity of the segments
+    static constexpr size_t fields = [] {
+      if constexpr (sizeof...(Args)) {
+        return CheckSpecsTypes<table, Args...>();
+      } else {
+        return 0;
+      }
+    }();
+    static constexpr size_t literal = parser::Literal(table, sizeof(S::string));
+    static constexpr size_t segments = 2 * quantity + 1;
+
+    template <const size_t I, typename Type> static consteval size_t StringLength() {
+      if constexpr (Specifier::StringOfCharacters == table.data[I].specifier) {
+        return FieldLength<table.data[I], Type>();
+      } else {
+        return 0;
+      }
+    }
+
+    // Max length of the strings (%s), the scatter-gather output passes them without copying
+    static constexpr size_t strings = []<size_t... I>(std::index_sequence<I...>) {
+      return (size_t{0} + ... + StringLength<I, Args>());
+    }(std::index_sequence_for<Args...>{});
+
+    // The string is passed by the chunks if it doesn't fit into the one chunk
+    static constexpr bool streamed = chunk && ((literal + fields + 1) > chunk);
+  };
+
+  /**
+   * @brief Inner fixed-size block of the streamed output, the parts are added in order and the block is passed when it is full
+   *
+   */
+  struct Stream {
+    const Format &format; // Owner of the output
+    char block[chunk + 1];
+    size_t size = 0;  // Length of the data in the block
+    size_t total = 0; // Length of the passed data
+
+    inline explicit Stream(const Format &f) : format(f) {}
+
+    inline void flush() {
+      if (size) {
+        block[size] = '\0';
+        format.pass(block, size);
+        total += size;
+        size = 0;
+      }
+    }
+
+    // Add the literal: by parts of the block or directly from the memory if the output has the known length
+    inline void literal(const char *data, size_t length) {
+      if constexpr (write<Puts> || gather<Puts>) {
+        if (length > (chunk - size)) {
+          flush();
+          if (length >= chunk) {
+            format.pass(data, length);
+            total += length;
+            return;
+          }
+        }
+      }
+      while (length) {
+        if (size == chunk) {
+          flush();
+        }
+        const size_t part = ((chunk - size) < length) ? (chunk - size) : length;
+        std::memcpy(&block[size], data, part);
+        size += part;
+        data += part;
+        length -= part;
+      }
+    }
+
+    // Place for the field with the provided max length
+    inline char *reserve(const size_t length) {
+      if ((chunk - size) < length) {
+        flush();
+      }
+      return &block[size];
+    }
+  };
+
+  /**
+   * @brief         Format the string into the stream (the compile-time strings are added as literals)
+   *
+   * @tparam S      String type
+   * @param stream  Stream of the output
+   * @param args    Variables that should be formatted and placed inside string
+   */
+  template <typename S, typename... Args> static inline void stream(Stream &stream, const Args... args) {
+    size_t counterSource = 0;
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = Layout<S, Args...>::table;
+      const auto next = [&]<size_t I, typename Type>(const std::integral_constant<size_t, I>, const Type arg) {
+        constexpr auto &data = table.data[I];
+        stream.literal(&S::string[counterSource], data.position - counterSource);
+        using Check = SpecCheck<data.specifier, Type>;
+        using W = Width<data.width, data.bare, data.precision>;
+        if constexpr (Specifier::StringOfCharacters == data.specifier) {
+          const auto view = Check::view(arg, W{});
+          stream.literal(view.data, view.length);
+        } else {
+          constexpr size_t max = FieldLength<data, Type>();
+          static_assert(max <= chunk, "ERROR: The chunk should be not less than the max length of each field (11 for %d of int32_t, 21 - for %d of int64_t)!");
+          stream.size += Check::formatArg(stream.reserve(max), arg, W{});
+        }
+        counterSource = data.position + data.size;
+      };
+      [&]<size_t... I>(std::index_sequence<I...>) { (next(std::integral_constant<size_t, I>{}, args), ...); }(std::index_sequence_for<Args...>{});
+    }
+    stream.literal(&S::string[counterSource], sizeof(S::string) - 1 - counterSource);
+  }
+
+  /**
+   * @brief         Format the string into the buffer (without '\0')
+   *
+   * @tparam S      String type
+   * @param buffer  Current buffer position in the result string
+   * @param args    Variables that should be formatted and placed inside string
+   * @return        Length of the result
+   */
+  template <typename S, typename... Args> static constexpr size_t compose(char *buffer, const Args... args) {
+    size_t counterSource = 0;
+    size_t counterResult = 0;
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = Layout<S, Args...>::table;
+      const auto parse = [&]<size_t I, typename Type>(const std::integral_constant<size_t, I>, const Type arg) {
+        while (counterSource < table.data[I].position) {
+          buffer[counterResult++] = S::string[counterSource++];
+        }
+
+        counterResult +=
+            SpecCheck<table.data[I].specifier, Type>::formatArg(&buffer[counterResult], arg, Width<table.data[I].width, table.data[I].bare, table.data[I].precision>{});
+        counterSource += table.data[I].size;
+      };
+      [&]<size_t... I>(std::index_sequence<I...>) { (parse(std::integral_constant<size_t, I>{}, args), ...); }(std::index_sequence_for<Args...>{});
+    }
+    while (counterSource < (sizeof(S::string) - 1)) {
+      buffer[counterResult++] = S::string[counterSource++];
+    }
+    return counterResult;
+  }
+
+  // Total length of the segments (the run-time strings have the variable length)
+  static inline size_t Length(const Segment *segments, const size_t quantity) {
+    size_t length = 0;
+    for (size_t i = 0; i < quantity; i++) {
+      length += segments[i].length;
+    }
+    return length;
+  }
+
+  /**
+   * @brief                 Add segments of the string: the literals are passed directly from the string, the fields are formatted into the buffer
+   *
+   * @tparam S              String type
+   * @param segments        Array of the segments
+   * @param counterSegments Quantity of the segments in the array
+   * @param fields          Buffer for the formatted fields (the compile-time strings are passed without copying)
+   * @param counterFields   Length of the formatted fields in the buffer
+   * @param args            Variables that should be formatted
+   */
+  template <typename S, typename... Args>
+  static inline void scatter(Segment *segments, size_t &counterSegments, char *fields, size_t &counterFields, const Args... args) {
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = Layout<S, Args...>::table;
+      const auto next = [&]<size_t I, typename Type>(const std::integral_constant<size_t, I>, const Type arg) {
+        constexpr auto begin = I ? (table.data[I - 1].position + table.data[I - 1].size) : 0;
+        constexpr auto end = table.data[I].position;
+        if constexpr (end > begin) {
+          segments[counterSegments++] = {&S::string[begin], end - begin};
+        }
+
+        using W = Width<table.data[I].width, table.data[I].bare, table.data[I].precision>;
+        if constexpr (Specifier::StringOfCharacters == table.data[I].specifier) {
+          segments[counterSegments++] = SpecCheck<table.data[I].specifier, Type>::view(arg, W{});
+        } else {
+          const auto len = SpecCheck<table.data[I].specifier, Type>::formatArg(&fields[counterFields], arg, W{});
+          segments[counterSegments++] = {&fields[counterFields], len};
+          counterFields += len;
+        }
+
+        if constexpr (((I + 1) == sizeof...(Args)) && ((sizeof(S::string) - 1) > (end + table.data[I].size))) {
+          constexpr auto last = end + table.data[I].size;
+          segments[counterSegments++] = {&S::string[last], sizeof(S::string) - 1 - last};
+        }
+      };
+      [&]<size_t... I>(std::index_sequence<I...>) { (next(std::integral_constant<size_t, I>{}, args), ...); }(std::index_sequence_for<Args...>{});
+    } else if constexpr (sizeof(S::string) > 1) {
+      segments[counterSegments++] = {S::string, sizeof(S::string) - 1};
+    }
+  }
+
+  // Value of the argument that is known in the compile-time (the compile-time strings are passed as they are)
+  template <typename T> struct Known {
+    using Type = T;
+    static constexpr T value{};
+  };
+  template <const auto v> struct Known<Constant<v>> {
+    using Type = typename Constant<v>::Type;
+    static constexpr Type value = v;
+  };
+
+  // The line with the constant arguments formatted in the compile-time (with the worst-case size)
+  template <typename S, typename... Args> static constexpr auto folded = [] {
+    using L = Layout<S, typename Known<Args>::Type...>;
+    Line<L::literal + L::fields + 1> line{};
+    line.length = compose<S>(line.data, Known<Args>::value...);
+    return line;
+  }();
+
+  /**
+   * @brief             Convert the data buffer to the hexadecimal bytes after the line in the block, the block is passed when it is full
+   *                    (the line with the short data buffer and the end are passed to the output at once)
+   *
+   * @tparam E          Compile time string after the data buffer
+   * @param block       Block on the stack (hexBlock and the end after the line at least)
+   * @param size        Length of the line that is formatted in the block
+   * @param dataBuffer  Object with dynamic data
+   * @return            Number of the written symbols
+   */
+  template <typename E, const size_t N> inline size_t hexdump(char (&block)[N], size_t size, const DataBuffer &dataBuffer) const {
+    // The byte takes the line ending before it, the separator and the pair, the block needs '\0' after it
+    constexpr size_t room = 2 + 1 + 2 + 1;
+    static_assert(N >= (hexBlock + sizeof(E::string) + 2), "ERROR: The block should have the space for the hexadecimal bytes and the end!");
+    static_assert(N > room, "ERROR: The block should have the space for one byte of the data buffer!");
+    size_t total = 0;
+    size_t column = 0;
+    const auto flush = [&]() {
+      block[size] = '\0';
+      pass(block, size);
+      total += size;
+      size = 0;
+    };
+    for (size_t i = 0; i < dataBuffer.length; i++) {
+      if ((size + room) > N) {
+        flush();
+      }
+      if (dataBuffer.perLine && (dataBuffer.perLine == column)) {
+        block[size++] = '\r';
+        block[size++] = '\n';
+        column = 0;
+      }
+      if (dataBuffer.separator) {
+        block[size++] = dataBuffer.separator;
+      }
+      const auto &pair = kernels::hex.pairs[static_cast<unsigned char>(dataBuffer.data[i])];
+      block[size++] = pair[0];
+      block[size++] = pair[1];
+      column++;
+    }
+    if ((size + sizeof(E::string) + 2) > N) {
+      flush();
+    }
+    block[size++] = '\r';
+    block[size++] = '\n';
+    std::memcpy(&block[size], E::string, sizeof(E::string) - 1);
+    size += sizeof(E::string) - 1;
+    flush();
+    return total;
+  }
+
+  // Max length of the converted data buffer (the line endings are taken into account for each byte to avoid the division)
+  static constexpr size_t HexLength(const size_t length, const bool separator = true, const bool perLine = true) {
+    return length * ((separator ? 3 : 2) + (perLine ? 2 : 0)) + 2;
+  }
+  static inline size_t HexLength(const DataBuffer &dataBuffer) { return HexLength(dataBuffer.length, dataBuffer.separator, dataBuffer.perLine); }
+
+  /**
+   * @brief             Convert the data buffer to the hexadecimal bytes into the buffer at once (it should have HexLength() space)
+   *
+   * @param buffer      Current buffer position in the result string
+   * @param dataBuffer  Object with dynamic data
+   * @return            Number of the written symbols
+   */
+  static inline size_t hexcompose(char *buffer, const DataBuffer &dataBuffer) {
+    size_t size = 0;
+    size_t column = 0;
+    for (size_t i = 0; i < dataBuffer.length; i++) {
+      if (dataBuffer.perLine && (dataBuffer.perLine == column)) {
+        buffer[size++] = '\r';
+        buffer[size++] = '\n';
+        column = 0;
+      }
+      if (dataBuffer.separator) {
+        buffer[size++] = dataBuffer.separator;
+      }
+      const auto &pair = kernels::hex.pairs[static_cast<unsigned char>(dataBuffer.data[i])];
+      buffer[size++] = pair[0];
+      buffer[size++] = pair[1];
+      column++;
+    }
+    buffer[size++] = '\r';
+    buffer[size++] = '\n';
+    return size;
+  }
+
+  /**
+   * @brief             Pass the line and the data buffer (not longer than bound) to the output in one call: the gather output takes
+   *                    the segments of the line, the hexadecimal pairs of the table, the separators and the line endings,
+   *                    the other outputs take the block on the stack with the whole converted data
+   *
+   * @tparam E          Compile time string after the data buffer
+   * @tparam line       Max length of the line before the data buffer
+   * @param composer    Formats the line into the block and returns its length
+   * @param dataBuffer  Object with dynamic data
+   * @return            Number of the written symbols
+   */
+  template <typename E, const size_t line, typename F> inline size_t hexonce(const F &composer, const DataBuffer &dataBuffer) const {
+    static_assert(bound, "ERROR: The data buffer is passed in one call only with the max length of the data (bound of the Format)!");
+    if constexpr (gather<Puts>) {
+      using End = decltype(string<"\r\n"> + string<E::string>);
+      // The byte takes the line ending before it, the separator and the pair
+      char block[line + 1];
+      Segment segments[1 + 3 * bound + 1];
+      size_t quantity = 0;
+      size_t length = composer(block);
+      segments[quantity++] = {block, length};
+      size_t column = 0;
+      for (size_t i = 0; i < dataBuffer.length; i++) {
+        if (dataBuffer.perLine && (dataBuffer.perLine == column)) {
+          segments[quantity++] = {"\r\n", 2};
+          column = 0;
+        }
+        if (dataBuffer.separator) {
+          segments[quantity++] = {&dataBuffer.separator, 1};
+        }
+        segments[quantity++] = {kernels::hex.pairs[static_cast<unsigned char>(dataBuffer.data[i])], 2};
+        column++;
+      }
+      segments[quantity++] = {End::string, sizeof(End::string) - 1};
+      for (size_t i = 1; i < quantity; i++) {
+        length += segments[i].length;
+      }
+      puts.writev(segments, quantity);
+      return length + 1;
+    } else {
+      char block[line + HexLength(bound) + sizeof(E::string)];
+      size_t length = composer(block);
+      length += hexcompose(&block[length], dataBuffer);
+      std::memcpy(&block[length], E::string, sizeof(E::string) - 1);
+      length += sizeof(E::string) - 1;
+      block[length] = '\0';
+      pass(block, length);
+      return length + 1;
+    }
+  }
+
+  /**
+   * @brief   Inner function that creates the descriptor for the passed string and argument types
+   *
+   * @tparam  S String type
+   * @tparam  data Max size of the data buffer header in the record (0 - record without data buffer)
+   * @return  Descriptor object (all properties are static)
+   */
+  template <typename S, const unsigned char data, typename... Args> static consteval auto MakeDescriptor() {
+    constexpr auto buffer = static_cast<unsigned char>(0x80 | 0x20 | 0x10); // The length is LEB128, the separator and the bytes per line follow
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = parser::table<S>;
+      static_assert(parser::CheckWidth(table), "ERROR: The only decimals and hexadecimals allow to have a width (and '#' - the only hexadecimals and pointers)!");
+      static_assert(parser::CheckPrecision(table), "ERROR: The only '%f', '%q' (up to 9 digits) and '%s' allow to have a precision!");
+      return []<size_t... I>(std::index_sequence<I...>) {
+        if constexpr (data) {
+          return Descriptor<S, SpecCheck<table.data[I].specifier, Coded<table.data[I].specifier, table.data[I].precision, Args>>::bytes..., buffer>{};
+        } else {
+          return Descriptor<S, SpecCheck<table.data[I].specifier, Coded<table.data[I].specifier, table.data[I].precision, Args>>::bytes...>{};
+        }
+      }(std::index_sequence_for<Args...>{});
+    } else if constexpr (data) {
+      return Descriptor<S, buffer>{};
+    } else {
+      return Descriptor<S>{};
+    }
+  }
+
+  // String of the record with the prefix (the source location of the string is kept)
+  template <typename P, typename S> static consteval auto Join() {
+    if constexpr (located_string<S>) {
+      return wrappers::Located<P::instance + S::instance, S::location>{};
+    } else {
+      return wrappers::String<P::instance + S::instance>{};
+    }
+  }
+
+  /**
+   * @brief         Forms the binary record [ID][arguments][length][separator][bytes per line][data]([ID of the end]) and passes it
+   *                to the output at once: the reserved space is used for the whole record if the output is a stage, writev() - if it is a gather,
+   *                one write() of the block on the stack - if the data is bounded (the data and the end are separate write() calls otherwise)
+   *
+   * @tparam S      String type
+   * @tparam data   Max size of the data buffer header in the record (0 - record without data buffer)
+   * @tparam T      String type of the end that is passed after the data as its own record (void - without the end)
+   * @param dumped  Data buffer (its content is passed after the record as it is), nullptr - record without data buffer
+   * @param args    Variables that should be placed inside record
+   *
+   * @return        Size of the record with the data
+   */
+  template <typename S, const unsigned char data, typename T, typename... Args>
+  inline size_t encode(const DataBuffer *dumped, const Args... args) const {
+    // General check fot the specifiers quantity the same as the quantity of arguments
+    static constexpr auto specifiersQuantity = SpecifierQuantity(S{});
+    static_assert(sizeof...(args) == specifiersQuantity,
+                  "ERROR: The quantity of the specifiers in the string is not the same as the quantity of arguments!");
+
+    // Descriptor contains all compile-time properties of the record
+    using Record = decltype(MakeDescriptor<S, data, Args...>());
+
+    // Max size of the record on the target
+    static constexpr size_t size = bytes<S, Args...> + data;
+    const char *payload = nullptr;
+    std::uint32_t length = 0;
+    if constexpr (data) {
+      payload = dumped->data;
+      length = static_cast<std::uint32_t>(dumped->length);
+    }
+
+    // Places the record into the buffer
+    const auto place = [&](char *buffer) {
+      const auto id = Record::id();
+      std::memcpy(buffer, &id, sizeof(id));
+      size_t counter = sizeof(id);
+
+      if constexpr (sizeof...(args)) {
+        constexpr auto &table = parser::table<S>;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+          ((counter += SpecCheck<table.data[I].specifier, Coded<table.data[I].specifier, table.data[I].precision, Args>>::encodeArg(&buffer[counter],
+                                                                                                Coded<table.data[I].specifier, table.data[I].precision, Args>(args))),
+           ...);
+        }(std::index_sequence_for<Args...>{});
+      }
+
+      if constexpr (data) {
+        counter += kernels::Varint(&buffer[counter], length);
+        buffer[counter++] = dumped->separator;
+        counter += kernels::Varint(&buffer[counter], static_cast<std::uint32_t>(dumped->perLine));
+      }
+      return counter;
+    };
+
+    // The end is the record without the arguments
+    static constexpr size_t tail = std::is_void_v<T> ? 0 : sizeof(std::uint32_t);
+    const auto end = [] {
+      if constexpr (tail) {
+        return Descriptor<T>::id();
+      } else {
+        return std::uint32_t{0};
+      }
+    }();
+
+    // Pass result to the output
+    if constexpr (stage<Puts>) {
+      auto *buffer = puts.reserve(size + length + tail);
+      if (nullptr == buffer) {
+        return 0;
+      }
+      const auto counter = place(buffer);
+      if constexpr (data) {
+        std::memcpy(&buffer[counter], payload, length);
+      }
+      if constexpr (tail) {
+        std::memcpy(&buffer[counter + length], &end, tail);
+      }
+      puts.commit(buffer, counter + length + tail);
+      return counter + length + tail;
+    } else if constexpr (gather<Puts> && data) {
+      char buffer[size];
+      const Segment segments[] = {{buffer, place(buffer)}, {payload, length}, {reinterpret_cast<const char *>(&end), tail}};
+      puts.writev(segments, tail ? 3 : 2);
+      return segments[0].length + length + tail;
+    } else {
+      // The data (not longer than bound) and the end are copied after the record to pass it by one write()
+      static constexpr bool whole = bound && data;
+      char buffer[size + (whole ? (bound + tail) : 0)];
+      auto counter = place(buffer);
+      if constexpr (whole) {
+        std::memcpy(&buffer[counter], payload, length);
+        std::memcpy(&buffer[counter + length], &end, tail);
+        counter += length + tail;
+      }
+      if constexpr (std::is_same_v<bool, decltype(puts.write(buffer, counter))>) {
+        if (!puts.write(buffer, counter)) {
+          timeline<typename Unwrap<Puts>::type>.lost(); // The decoder hasn't got the time of this record
+        }
+      } else {
+        puts.write(buffer, counter);
+      }
+      if constexpr (whole) {
+        return counter;
+      } else {
+        if constexpr (data) {
+          puts.write(payload, length);
+        }
+        if constexpr (tail) {
+          puts.write(reinterpret_cast<const char *>(&end), tail);
+        }
+        return counter + length + tail;
+      }
+    }
+  }
+
+public:
+  /**
+   * @brief Consteval constructor for the object
+   *
+   * @param p reference to the Puts object (with callback function to some output (Debugger, UART, USB, et cetera))
+   */
+  consteval Format(const Puts &p) : puts(p) {}
 
   /**
-   * @brief         The main fuction of the formatter, passes string to the put.puts() function
+   * @brief         The main fuction of the formatter, passes string to the put.write() or put.puts() function
    *                Checks and calculations are performed in compile-time (if it is possible)
    *
    * @param str     Compile time string string with the specifiers to be formatted
@@ -474,56 +2056,233 @@ public:
    */
   template <typename S, typename... Args>
   requires const_string<S>
-  inline size_t printf(const S str, const Args... args) const {
-    // General check fot the specifiers quantity the same as the quantity of arguments
-    static constexpr auto specifiersQuantity = SpecifierQuantity(str);
-    static_assert(sizeof...(args) == specifiersQuantity,
-                  "ERROR: The quantity of the specifiers in the string is not the same as the quantity of arguments!");
+  inline size_t printf(const S, const Args... args) const {
+    using L = Layout<S, Args...>;
+
+    // Lock-free staging: the line is formatted in place of the reserved space and committed at once
+    if constexpr (stage<Puts>) {
+      auto *data = puts.reserve(L::literal + L::fields);
+      if (nullptr == data) {
+        return 0;
+      }
+      const auto length = compose<S>(data, args...);
+      puts.commit(data, length);
+      return length + 1;
+    } else if constexpr (gather<Puts>) {
+      // Scatter-gather output: the only formatted fields are in the buffer, literal segments are passed directly from the string
+      char fields[L::fields - L::strings + 1];
+      Segment segments[L::segments];
+      size_t counterFields = 0;
+      size_t counterSegments = 0;
+      scatter<S>(segments, counterSegments, fields, counterFields, args...);
+      puts.writev(segments, counterSegments);
+      return Length(segments, counterSegments) + 1;
+    } else if constexpr (L::streamed) {
+      Stream output{*this};
+      stream<S>(output, args...);
+      output.flush();
+      return output.total + 1;
+    } else {
+      char buffer[L::literal + L::fields + 1];
+      const auto length = compose<S>(buffer, args...);
+      buffer[length] = '\0';
+      pass(buffer, length);
+      return length + 1;
+    }
+  }
 
-    // Form specifiers structure
-    constexpr SpecifierTable<specifiersQuantity> table(str);
-    constexpr bool checkWidth = [&]() {
-      for (const auto &d : table.data) {
-        if (((d.specifier != Specifier::SignedDecimalInteger) && (d.specifier != Specifier::UnsignedDecimalInteger)) && d.width) {
-          return false;
+  /**
+   * @brief         Overload for the string with the shared prefix and end: the output is the same as for the concatenated string,
+   *                but the literals of the frame are placed in the memory only once for all call sites
+   *
+   * @param Frame   Prefix and end, the first arguments are formatted into the prefix
+   * @param S       Compile time string string with the specifiers to be formatted
+   * @param args    Variables that should be formatted and placed inside prefix and string
+   *
+   * @example       printf(iso::format::frame<decltype(iso::format::string<"[%t] UDP: ">), decltype(iso::format::string<"\r\n">)>,
+   *                       iso::format::string<"sent %u">, tick, size);
+   *
+   * @return        Number of the written symbols
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  requires const_string<S>
+  inline size_t printf(const Frame<P, E>, const S, const Args... args) const {
+    constexpr auto prefixQuantity = SpecifierQuantity(P{});
+    static_assert(prefixQuantity <= sizeof...(Args), "ERROR: The quantity of the specifiers in the prefix is more than the quantity of arguments!");
+    static_assert(!SpecifierQuantity(E{}), "ERROR: The end of the frame can't have the specifiers!");
+    using Types = std::tuple<Args...>;
+    const Types values{args...};
+    return [&]<size_t... I, size_t... J>(std::index_sequence<I...>, std::index_sequence<J...>) -> size_t {
+      using LP = Layout<P, std::tuple_element_t<I, Types>...>;
+      using LS = Layout<S, std::tuple_element_t<prefixQuantity + J, Types>...>;
+      if constexpr (stage<Puts>) {
+        auto *data = puts.reserve(LP::literal + LP::fields + LS::literal + LS::fields + sizeof(E::string) - 1);
+        if (nullptr == data) {
+          return 0;
+        }
+        size_t length = compose<P>(data, std::get<I>(values)...);
+        length += compose<S>(&data[length], std::get<prefixQuantity + J>(values)...);
+        std::memcpy(&data[length], E::string, sizeof(E::string) - 1);
+        length += sizeof(E::string) - 1;
+        puts.commit(data, length);
+        return length + 1;
+      } else if constexpr (gather<Puts>) {
+        char fields[LP::fields - LP::strings + LS::fields - LS::strings + 1];
+        Segment segments[LP::segments + LS::segments + 1];
+        size_t counterFields = 0;
+        size_t counterSegments = 0;
+        scatter<P>(segments, counterSegments, fields, counterFields, std::get<I>(values)...);
+        scatter<S>(segments, counterSegments, fields, counterFields, std::get<prefixQuantity + J>(values)...);
+        if constexpr (sizeof(E::string) > 1) {
+          segments[counterSegments++] = {E::string, sizeof(E::string) - 1};
         }
+        puts.writev(segments, counterSegments);
+        return Length(segments, counterSegments) + 1;
+      } else if constexpr (chunk && ((LP::literal + LP::fields + LS::literal + LS::fields + sizeof(E::string)) > chunk)) {
+        Stream output{*this};
+        stream<P>(output, std::get<I>(values)...);
+        stream<S>(output, std::get<prefixQuantity + J>(values)...);
+        output.literal(E::string, sizeof(E::string) - 1);
+        output.flush();
+        return output.total + 1;
+      } else {
+        char buffer[LP::literal + LP::fields + LS::literal + LS::fields + sizeof(E::string)];
+        size_t length = compose<P>(buffer, std::get<I>(values)...);
+        length += compose<S>(&buffer[length], std::get<prefixQuantity + J>(values)...);
+        std::memcpy(&buffer[length], E::string, sizeof(E::string));
+        length += sizeof(E::string) - 1;
+        pass(buffer, length);
+        return length + 1;
       }
-      return true;
-    }();
-    static_assert(checkWidth, "ERROR: The only decimals allow to have a width!");
+    }(std::make_index_sequence<prefixQuantity>{}, std::make_index_sequence<sizeof...(Args) - prefixQuantity>{});
+  }
+
+  /**
+   * @brief       Format the string with the constant arguments in the compile-time
+   *
+   * @param str   Compile time string string with the specifiers to be formatted
+   * @param args  Constants (iso::format::constant) and compile-time strings
+   *
+   * @example     constexpr auto banner = fold(iso::format::string<"v%u.%u (%s)\r\n">, iso::format::constant<2U>, iso::format::constant<1U>, mode);
+   *
+   * @return      New consteval String object (the same as iso::format::string of the result)
+   */
+  template <typename S, typename... Args>
+  requires const_string<S> && is_folded_v<Args...>
+  static consteval auto fold(const S, const Args...) {
+    constexpr auto &line = folded<S, Args...>;
+    return []<size_t... I>(std::index_sequence<I...>) {
+      constexpr char text[] = {line.data[I]..., '\0'};
+      static_assert(((line.data[I] != '%') && ...), "ERROR: The constant arguments can't be formatted to '%' (the result is a format string)!");
+      return wrappers::String<wrappers::Wrap<sizeof(text)>(text)>{};
+    }(std::make_index_sequence<line.length>{});
+  }
 
-    // Check specifiers type and calculate length
-    static constexpr auto length = CheckSpecsTypes<table>(Args{}...) + sizeof(S::string);
+  /**
+   * @brief         Overload for the constant arguments: the line is formatted in the compile-time and passed as one literal
+   *
+   * @example       printf(iso::format::string<"Build %u, %s, gain %.2f\r\n">, iso::format::constant<1234U>, mode, iso::format::constant<0.75>);
+   *
+   * @return        Number of the written symbols
+   */
+  template <typename S, typename... Args>
+  requires const_string<S> && is_folded_v<Args...>
+  inline size_t printf(const S, const Args...) const {
+    return printf(fold(S{}, Args{}...));
+  }
 
-    // Buffer for the result string
-    char buffer[length];
+  /**
+   * @brief       Worst-case length of the formatted string (without '\0') to size the buffers in the compile-time
+   *
+   * @tparam S    String type
+   * @tparam Args Argument types
+   */
+  template <typename S, typename... Args> static constexpr size_t length = Layout<S, Args...>::literal + Layout<S, Args...>::fields;
 
-    // Parsing string
-    size_t counterSource = 0;
-    size_t counterResult = 0;
-    auto parse = [&]<typename First, typename... Rest>(auto &&parse, const First first, const Rest... rest) -> void {
-      constexpr auto tableIndex = table.size - (sizeof...(Rest) + 1);
-      while (counterSource < table.data[tableIndex].position) {
-        buffer[counterResult++] = S::string[counterSource++];
-      }
+  /**
+   * @brief       Worst-case size of the binary record (without the length and the data of the DataBuffer) to size the buffers in the compile-time
+   *
+   * @tparam S    String type
+   * @tparam Args Argument types
+   */
+  template <typename S, typename... Args> static constexpr size_t bytes = []() consteval {
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = parser::table<S>;
+      return []<size_t... I>(std::index_sequence<I...>) {
+        return sizeof(std::uint32_t) + (RecordSize<table.data[I], Args>() + ...);
+      }(std::index_sequence_for<Args...>{});
+    } else {
+      return sizeof(std::uint32_t);
+    }
+  }();
 
-      counterResult +=
-          SpecCheck<table.data[tableIndex].specifier, First>::formatArg(&buffer[counterResult], first, Width<table.data[tableIndex].width>{});
-      counterSource += table.data[tableIndex].size;
+  // Max size of the data buffer header in the binary record: LEB128 of the length, the separator and LEB128 of the bytes per line
+  static constexpr unsigned char dump = 2 * ((8 * sizeof(std::uint32_t) + 6) / 7) + 1;
 
-      if constexpr (sizeof...(Rest)) {
-        parse(parse, rest...);
-      } else {
-        while (counterSource < sizeof(S::string)) {
-          buffer[counterResult++] = S::string[counterSource++];
-        }
-      }
-    };
-    parse(parse, args...);
+  // Max length of the converted data buffer with the line ending after it (the only line ending if the data isn't bounded)
+  static constexpr size_t hexed = HexLength(bound);
 
-    // Pass result to the output
-    puts.puts(buffer);
-    return counterResult;
+  /**
+   * @brief         Format the string into the provided buffer instead of the output (the same checks and formatting as printf)
+   *                The string is truncated to the size of the buffer and always ends with '\0' (as snprintf does)
+   *
+   * @param buffer  Buffer for the result
+   * @param size    Size of the buffer (with '\0')
+   * @param str     Compile time string string with the specifiers to be formatted
+   * @param args    Variables that should be formatted and placed inside string
+   *
+   * @example       format_to(payload, sizeof(payload), iso::format::string<"AT+CIPSEND=%u\r\n">, size);
+   *
+   * @return        Length of the result (without '\0')
+   */
+  template <typename S, typename... Args>
+  requires const_string<S>
+  static inline size_t format_to(char *buffer, const size_t size, const S, const Args... args) {
+    constexpr auto max = length<S, Args...>;
+    if (0 == size) {
+      return 0;
+    }
+    if (size > max) {
+      const auto result = compose<S>(buffer, args...);
+      buffer[result] = '\0';
+      return result;
+    }
+
+    // The buffer is less than the worst case: the string is formatted on the stack and truncated
+    char line[max + 1];
+    auto result = compose<S>(line, args...);
+    if (result >= size) {
+      result = size - 1;
+    }
+    std::memcpy(buffer, line, result);
+    buffer[result] = '\0';
+    return result;
+  }
+
+  /**
+   * @brief         Overload for the arrays (the size is taken from the type)
+   * @return        Length of the result (without '\0')
+   */
+  template <const size_t N, typename S, typename... Args>
+  requires const_string<S>
+  static inline size_t format_to(char (&buffer)[N], const S str, const Args... args) {
+    return format_to(static_cast<char *>(buffer), N, str, args...);
+  }
+
+  /**
+   * @brief         Overload that returns the string in the array of the worst-case size (never truncated)
+   *
+   * @example       const auto line = format_to(iso::format::string<"{\"t\":%d}">, temperature); // line.data, line.length
+   *
+   * @return        Line with the formatted string and its length
+   */
+  template <typename S, typename... Args>
+  requires const_string<S>
+  static inline Line<length<S, Args...> + 1> format_to(const S, const Args... args) {
+    Line<length<S, Args...> + 1> line;
+    line.length = compose<S>(line.data, args...);
+    line.data[line.length] = '\0';
+    return line;
   }
 
   /**
@@ -533,7 +2292,7 @@ public:
   template <typename S>
   requires const_string<S>
   inline size_t printf(const S) const {
-    puts.puts(S::string);
+    pass(S::string, sizeof(S::string) - 1);
     return sizeof(S::string);
   }
 
@@ -546,6 +2305,7 @@ public:
    * @param args        Variables that should be formatted and placed inside string
    *
    * @example           printf(iso::format::string<"This is just a buffer len [%u]: ">, iso::format::DataBuffer(buf, sizeof(buf)), sizeof(buf));
+   * @example           printf(iso::format::string<"Dump:\r\n">, iso::format::DataBuffer(buf, sizeof(buf), ':', 16));
    *
    * @return            Number of the written symbols
    */
@@ -555,18 +2315,104 @@ public:
     if (nullptr == dataBuffer.data) {
       return 0;
     }
-    const auto len = printf(str, args...);
-    char buffer[] = " XX";
-    char val = '\0';
-    for (size_t i = 0; i < dataBuffer.length; i++) {
-      val = dataBuffer.data[i] >> 4;
-      buffer[1] = (val < 0xA) ? val + '0' : val + ('A' - 0xA);
-      val = dataBuffer.data[i] & 0xF;
-      buffer[2] = (val < 0xA) ? val + '0' : val + ('A' - 0xA);
-      puts.puts(buffer);
+    if constexpr (bound) {
+      if (dataBuffer.length > bound) {
+        const size_t cut = bound;
+        return printf(str, DataBuffer(dataBuffer.data, cut, dataBuffer.separator, dataBuffer.perLine), args...);
+      }
+    }
+    if constexpr (stage<Puts>) {
+      using L = Layout<S, Args...>;
+      auto *data = puts.reserve(L::literal + L::fields + HexLength(dataBuffer));
+      if (nullptr == data) {
+        return 0;
+      }
+      size_t length = compose<S>(data, args...);
+      length += hexcompose(&data[length], dataBuffer);
+      puts.commit(data, length);
+      return length + 1;
+    } else if constexpr (bound) {
+      using L = Layout<S, Args...>;
+      return hexonce<std::remove_cv_t<decltype(string<"">)>, L::literal + L::fields>([&](char *block) { return compose<S>(block, args...); },
+                                                                                    dataBuffer);
+    } else {
+      using L = Layout<S, Args...>;
+      using E = std::remove_cv_t<decltype(string<"">)>;
+      if constexpr (chunk && ((L::literal + L::fields + hexBlock + sizeof(E::string) + 2) > chunk)) {
+        char block[hexBlock + sizeof(E::string) + 2];
+        return printf(str, args...) + hexdump<E>(block, 0, dataBuffer);
+      } else {
+        char block[L::literal + L::fields + hexBlock + sizeof(E::string) + 2];
+        return hexdump<E>(block, compose<S>(block, args...), dataBuffer) + 1;
+      }
+    }
+  }
+
+  /**
+   * @brief             Overload for the data buffers with the shared prefix and end (the end is after the data)
+   *
+   * @return            Number of the written symbols
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  requires const_string<S>
+  inline size_t printf(const Frame<P, E>, const S str, const DataBuffer &dataBuffer, const Args... args) const {
+    if (nullptr == dataBuffer.data) {
+      return 0;
+    }
+    if constexpr (bound) {
+      if (dataBuffer.length > bound) {
+        const size_t cut = bound;
+        return printf(Frame<P, E>{}, str, DataBuffer(dataBuffer.data, cut, dataBuffer.separator, dataBuffer.perLine), args...);
+      }
+    }
+    if constexpr (stage<Puts>) {
+      constexpr auto prefixQuantity = SpecifierQuantity(P{});
+      static_assert(prefixQuantity <= sizeof...(Args), "ERROR: The quantity of the specifiers in the prefix is more than the quantity of arguments!");
+      static_assert(!SpecifierQuantity(E{}), "ERROR: The end of the frame can't have the specifiers!");
+      using Types = std::tuple<Args...>;
+      const Types values{args...};
+      return [&]<size_t... I, size_t... J>(std::index_sequence<I...>, std::index_sequence<J...>) -> size_t {
+        using LP = Layout<P, std::tuple_element_t<I, Types>...>;
+        using LS = Layout<S, std::tuple_element_t<prefixQuantity + J, Types>...>;
+        auto *data = puts.reserve(LP::literal + LP::fields + LS::literal + LS::fields + HexLength(dataBuffer) + sizeof(E::string) - 1);
+        if (nullptr == data) {
+          return 0;
+        }
+        size_t length = compose<P>(data, std::get<I>(values)...);
+        length += compose<S>(&data[length], std::get<prefixQuantity + J>(values)...);
+        length += hexcompose(&data[length], dataBuffer);
+        std::memcpy(&data[length], E::string, sizeof(E::string) - 1);
+        length += sizeof(E::string) - 1;
+        puts.commit(data, length);
+        return length + 1;
+      }(std::make_index_sequence<prefixQuantity>{}, std::make_index_sequence<sizeof...(Args) - prefixQuantity>{});
+    } else {
+      constexpr auto prefixQuantity = SpecifierQuantity(P{});
+      using Types = std::tuple<Args...>;
+      const Types values{args...};
+      return [&]<size_t... I, size_t... J>(std::index_sequence<I...>, std::index_sequence<J...>) -> size_t {
+        using LP = Layout<P, std::tuple_element_t<I, Types>...>;
+        using LS = Layout<S, std::tuple_element_t<prefixQuantity + J, Types>...>;
+        constexpr size_t line = LP::literal + LP::fields + LS::literal + LS::fields;
+        if constexpr (bound) {
+          return hexonce<E, line>(
+              [&](char *block) {
+                const size_t length = compose<P>(block, std::get<I>(values)...);
+                return length + compose<S>(&block[length], std::get<prefixQuantity + J>(values)...);
+              },
+              dataBuffer);
+        } else if constexpr (chunk && ((line + hexBlock + sizeof(E::string) + 2) > chunk)) {
+          // The long line is passed by the chunks before the data buffer
+          char block[hexBlock + sizeof(E::string) + 2];
+          return printf(Frame<P, std::remove_cv_t<decltype(string<"">)>>{}, str, args...) + hexdump<E>(block, 0, dataBuffer);
+        } else {
+          char block[line + hexBlock + sizeof(E::string) + 2];
+          size_t length = compose<P>(block, std::get<I>(values)...);
+          length += compose<S>(&block[length], std::get<prefixQuantity + J>(values)...);
+          return hexdump<E>(block, length, dataBuffer) + 1;
+        }
+      }(std::make_index_sequence<prefixQuantity>{}, std::make_index_sequence<sizeof...(Args) - prefixQuantity>{});
     }
-    puts.puts("\r\n");
-    return (sizeof(buffer) - 1) * dataBuffer.length + len + (sizeof("\r\n") - 1);
   }
 
   /**
@@ -579,6 +2425,264 @@ public:
     constexpr auto res_str = string<S::string> + string<"\r\n">;
     return printf(res_str, args...);
   }
+
+  /**
+   * @brief         Binary analogue of the printf: passes ID of the string and raw arguments to the put.write() function
+   *                The string itself is not used on the target (it is in the descriptor to be formatted by the host)
+   *
+   * @param str     Compile time string string with the specifiers to be formatted
+   * @param args    Variables that should be placed inside record
+   *
+   * @example       record(iso::format::string<"I am a FATAL message! I have one dec %d and one hex %X values!\r\n">, -555, 0x1234U);
+   *
+   * @return        Size of the record
+   */
+  template <typename S, typename... Args>
+  requires const_string<S> && write<Puts>
+  inline size_t record(const S, const Args... args) const {
+    if constexpr (is_folded_v<Args...>) {
+      return encode<decltype(fold(S{}, Args{}...)), 0, void>(nullptr); // The constants are in the descriptor
+    } else {
+      return encode<S, 0, void>(nullptr, args...);
+    }
+  }
+
+  /**
+   * @brief             Overload for the data buffers (the data is passed as it is after the record)
+   *
+   * @param str         Compile time string string with the specifiers to be formatted
+   * @param dataBuffer  Object with dynamic data
+   * @param args        Variables that should be placed inside record
+   *
+   * @return            Size of the record with the data
+   */
+  template <typename S, typename... Args>
+  requires const_string<S> && write<Puts>
+  inline size_t record(const S str, const DataBuffer &dataBuffer, const Args... args) const {
+    if (nullptr == dataBuffer.data) {
+      return 0;
+    }
+    if constexpr (bound) {
+      if (dataBuffer.length > bound) {
+        const size_t cut = bound;
+        return record(str, DataBuffer(dataBuffer.data, cut, dataBuffer.separator, dataBuffer.perLine), args...);
+      }
+    }
+    return encode<S, dump, void>(&dataBuffer, args...);
+  }
+
+  /**
+   * @brief             Overload for the data buffers with the prefix and end: the end is passed after the data in the same transaction
+   *
+   * @param Frame       Prefix (joined with the string in the descriptor) and end (the record without arguments after the data)
+   * @param str         Compile time string string with the specifiers to be formatted
+   * @param dataBuffer  Object with dynamic data
+   * @param args        Variables that should be placed inside record (the prefix ones are the first)
+   *
+   * @return            Size of the record with the data
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  requires const_string<S> && write<Puts>
+  inline size_t record(const Frame<P, E>, const S str, const DataBuffer &dataBuffer, const Args... args) const {
+    if (nullptr == dataBuffer.data) {
+      return 0;
+    }
+    if constexpr (bound) {
+      if (dataBuffer.length > bound) {
+        const size_t cut = bound;
+        return record(Frame<P, E>{}, str, DataBuffer(dataBuffer.data, cut, dataBuffer.separator, dataBuffer.perLine), args...);
+      }
+    }
+    using End = std::conditional_t<(sizeof(E::string) > 1), E, void>;
+    return encode<decltype(Join<P, S>()), dump, End>(&dataBuffer, args...);
+  }
+
+private:
+  // Type of the argument that is kept for the deferred formatting (the same as in the binary record)
+  template <const auto table, const size_t I, typename Type> using Held = Coded<table.data[I].specifier, table.data[I].precision, Type>;
+
+  // Max size of the kept argument: the run-time strings are copied as [length][characters], the compile-time ones aren't kept at all
+  template <const auto table, const size_t I, typename Type> static consteval size_t KeptSize() {
+    using H = Held<table, I, Type>;
+    if constexpr (is_string_v<H>) {
+      return 0;
+    } else if constexpr (is_text_v<H>) {
+      return SpecCheck<Specifier::StringOfCharacters, H>::room;
+    } else {
+      return sizeof(H);
+    }
+  }
+
+  // Max size of the kept arguments of the string
+  template <typename S, typename... Args> static consteval size_t Kept() {
+    if constexpr (sizeof...(Args)) {
+      static_assert(sizeof...(Args) == SpecifierQuantity(S{}), "ERROR: The quantity of the specifiers in the string is not the same as the quantity of arguments!");
+      constexpr auto &table = parser::table<S>;
+      return [&]<size_t... I>(std::index_sequence<I...>) { return (KeptSize<table, I, Args>() + ...); }(std::index_sequence_for<Args...>{});
+    } else {
+      return 0;
+    }
+  }
+
+  // Copy the argument into the buffer, returns the size of the kept argument
+  template <const auto table, const size_t I, typename Type> static size_t KeepArg(char *buffer, const Type arg) {
+    using H = Held<table, I, Type>;
+    if constexpr (is_string_v<H>) {
+      return 0;
+    } else if constexpr (is_text_v<H>) {
+      return SpecCheck<Specifier::StringOfCharacters, H>::encodeArg(buffer, H(arg));
+    } else {
+      std::memcpy(buffer, &arg, sizeof(H));
+      return sizeof(H);
+    }
+  }
+
+  // Restore the argument from the buffer (the run-time strings point to the characters in the buffer)
+  template <const auto table, const size_t I, typename Type> static Held<table, I, Type> RestoreArg(const char *buffer, size_t &counter) {
+    using H = Held<table, I, Type>;
+    if constexpr (is_string_v<H>) {
+      return H{};
+    } else if constexpr (is_text_v<H>) {
+      constexpr auto prefix = SpecCheck<Specifier::StringOfCharacters, H>::prefix;
+      size_t length = static_cast<unsigned char>(buffer[counter]);
+      if constexpr (sizeof(std::uint16_t) == prefix) {
+        std::uint16_t size;
+        std::memcpy(&size, &buffer[counter], prefix);
+        length = size;
+      }
+      const H arg(&buffer[counter + prefix], length);
+      counter += prefix + length;
+      return arg;
+    } else {
+      struct {
+        char raw[sizeof(H)];
+      } bits;
+      std::memcpy(bits.raw, &buffer[counter], sizeof(H));
+      counter += sizeof(H);
+      return std::bit_cast<H>(bits);
+    }
+  }
+
+  // Properties of the data buffer that are kept before its data
+  struct Dumped {
+    size_t length;
+    size_t perLine;
+    char separator;
+  };
+
+public:
+  /**
+   * @brief     Max size of the arguments that are kept for the deferred formatting (iso::output::Defer)
+   *            The data of the DataBuffer is kept after them with its properties (sizeof(Dumped) + length)
+   *
+   * @tparam P  Compile time string with the prefix (its specifiers are the first)
+   * @tparam S  Compile time string string with the specifiers to be formatted
+   * @tparam Args Argument types
+   */
+  template <typename P, typename S, typename... Args> static constexpr size_t kept = Kept<decltype(Join<P, S>()), Args...>();
+
+  // Size of the properties of the DataBuffer in the kept arguments
+  static constexpr size_t dumped = sizeof(Dumped);
+
+  /**
+   * @brief         Copy the arguments into the buffer for the deferred formatting (nothing is formatted)
+   *                The run-time strings are copied up to their max length: the original ones might be changed before the format
+   *
+   * @param Frame   Prefix and end of the string (the same as for printf)
+   * @param str     Compile time string string with the specifiers to be formatted
+   * @param buffer  Buffer with at least kept<P, S, Args...> bytes
+   * @param args    Variables that should be formatted later
+   *
+   * @return        Size of the kept arguments
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  requires const_string<S>
+  static size_t keep(const Frame<P, E>, const S, char *buffer, const Args... args) {
+    size_t counter = 0;
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = parser::table<decltype(Join<P, S>())>;
+      [&]<size_t... I>(std::index_sequence<I...>) { ((counter += KeepArg<table, I>(&buffer[counter], args)), ...); }(std::index_sequence_for<Args...>{});
+    }
+    return counter;
+  }
+
+  /**
+   * @brief             Overload for the data buffers: the data is copied after the arguments with its properties
+   *
+   * @param buffer      Buffer with at least kept<P, S, Args...> + dumped + dataBuffer.length bytes
+   *
+   * @return            Size of the kept arguments with the data
+   */
+  template <typename P, typename E, typename S, typename... Args>
+  requires const_string<S>
+  static size_t keep(const Frame<P, E>, const S, char *buffer, const DataBuffer &dataBuffer, const Args... args) {
+    auto counter = keep(Frame<P, E>{}, S{}, buffer, args...);
+    const Dumped properties{dataBuffer.length, dataBuffer.perLine, dataBuffer.separator};
+    std::memcpy(&buffer[counter], &properties, sizeof(properties));
+    std::memcpy(&buffer[counter + sizeof(properties)], dataBuffer.data, dataBuffer.length);
+    return counter + sizeof(properties) + dataBuffer.length;
+  }
+
+  /**
+   * @brief         Format the kept arguments and pass the string to the output (the same as printf with the original arguments)
+   *
+   * @tparam P      Compile time string with the prefix
+   * @tparam E      Compile time string with the end
+   * @tparam S      Compile time string string with the specifiers to be formatted
+   * @tparam data   The arguments are kept with the DataBuffer
+   * @tparam Args   Original argument types
+   * @param buffer  Kept arguments
+   *
+   * @return        Number of the written symbols
+   */
+  template <typename P, typename E, typename S, const bool data, typename... Args> inline size_t replay(const char *buffer) const {
+    size_t counter = 0;
+    const auto print = [&](const auto... args) {
+      if constexpr (data) {
+        Dumped properties;
+        std::memcpy(&properties, &buffer[counter], sizeof(properties));
+        const DataBuffer dataBuffer(&buffer[counter + sizeof(properties)], properties.length, properties.separator, properties.perLine);
+        return printf(Frame<P, E>{}, S{}, dataBuffer, args...);
+      } else {
+        return printf(Frame<P, E>{}, S{}, args...);
+      }
+    };
+    if constexpr (sizeof...(Args)) {
+      constexpr auto &table = parser::table<decltype(Join<P, S>())>;
+      return [&]<size_t... I>(std::index_sequence<I...>) {
+        // The braced list restores the arguments in their order
+        const std::tuple<Held<table, I, Args>...> values{RestoreArg<table, I, Args>(buffer, counter)...};
+        return std::apply(print, values);
+      }(std::index_sequence_for<Args...>{});
+    } else {
+      return print();
+    }
+  }
+};
+
+namespace wrappers {
+// The output that is never called: Format is used only to fill the buffers with format_to
+struct Buffer {
+  void puts(const char *) const {}
 };
+} // namespace wrappers
+
+// Inline variable to use outside: worst-case length of the formatted string (without '\0')
+template <const_string S, typename... Args> inline constexpr size_t length = Format<wrappers::Buffer>::length<std::remove_cv_t<S>, Args...>;
+
+// Inline variable to use outside: worst-case size of the binary record (without the data of the DataBuffer)
+template <const_string S, typename... Args> inline constexpr size_t bytes = Format<wrappers::Buffer>::bytes<std::remove_cv_t<S>, Args...>;
+
+/**
+ * @brief   Format the string into the buffer without any output (please, check Format::format_to for the details)
+ *
+ * @example char payload[iso::format::length<decltype(iso::format::string<"temp %d">), int> + 1];
+ * @example iso::format::format_to(payload, iso::format::string<"temp %d">, temperature);
+ *
+ * @return  Length of the result (without '\0') or the Line for the overload without the buffer
+ */
+template <typename... Args> inline auto format_to(Args &&...args) -> decltype(Format<wrappers::Buffer>::format_to(std::forward<Args>(args)...)) {
+  return Format<wrappers::Buffer>::format_to(std::forward<Args>(args)...);
+}
 
 } // namespace iso::format
\ No newline at end of file
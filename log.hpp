@@ -33,6 +33,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "format.hpp"
 
 // C++ concepts should be enabled
@@ -52,12 +54,22 @@ concept time_func = requires(T &tick) {
 };
 
 /**
- * @brief     Concept to check that type is appropriate to iso::format::put and time_func concepts
+ * @brief     Concept to check the provided type has cycles() method (should return the free-running cycle counter (unsigned integral))
+ *
+ * @tparam T  The type should be checked
+ */
+template <typename T>
+concept cycles_func = requires(T &counter) {
+  { counter.cycles() } -> std::unsigned_integral;
+};
+
+/**
+ * @brief     Concept to check that type is appropriate to iso::format::sink and time_func concepts
  *
  * @tparam T  The type should be checked
  */
 template <typename T>
-concept time = iso::format::put<T> && time_func<T>;
+concept time = iso::format::sink<T> && time_func<T>;
 
 /**
  * @brief Enumeration of the trace levels
@@ -113,22 +125,871 @@ concept log_level = requires(T) {
   typename T::TraceLevelT;
 };
 
+// Representation of the traces on the output
+enum class Encoding {
+  Text,  // Formatted on the target
+  Binary // ID of the string and raw arguments (formatted on the host with the decoder)
+};
+
+// Filtering of the traces in the run-time (in addition to the compile-time LogLevel)
+enum class Filter {
+  Static, // The only compile-time LogLevel
+  Runtime // The traces are also compared with the threshold of the component (one load and compare before any formatting)
+};
+
+// Instrumentation of the call sites
+enum class Profile {
+  Disabled, // Nothing is counted
+  Enabled   // Each call site counts its hits, bytes and cycles (iso::log::costs to iterate)
+};
+
+// Source location of the call site (iso::format::located) in the text traces, the binary descriptors always contain it
+enum class Location {
+  Hidden, // Only the string
+  Prefix  // "file:line " before the string
+};
+
+// Resolution of the time mark (quantity of the digits after the point)
+enum class Resolution : unsigned char {
+  Milli = 3,
+  Micro = 6,
+  Nano = 9
+};
+
+// Time mark of the traces
+enum class Stamp {
+  Absolute, // Time from launch
+  Delta     // Time from the previous trace (of all Log objects with the same Clock)
+};
+
+/**
+ * @brief Source of the time mark (property of the Log, the default is tick() of the Output)
+ *
+ */
+struct Clock final {
+  unsigned long frequency; // Frequency of the free-running cycle counter in Hz (0 - tick() of the Output in milliseconds)
+  Resolution resolution;   // Resolution of the formatted time mark (only Resolution::Milli for tick())
+  Stamp stamp;             // Absolute or delta time mark
+};
+
+// Inline variables to use outside: time mark from the cycle counter, time from the previous trace by tick()
+template <const unsigned long frequency, const Resolution resolution = Resolution::Micro, const Stamp stamp = Stamp::Absolute>
+inline constexpr Clock cycles{frequency, resolution, stamp};
+inline constexpr Clock delta{0, Resolution::Milli, Stamp::Delta};
+
+/**
+ * @brief Size of the buffer on the stack for the long traces (property of the Log, the default is the buffer for the whole trace)
+ *
+ */
+struct Chunk final {
+  size_t size; // Size of the chunk in bytes (0 - the buffer for the whole trace)
+};
+
+// Inline variable to use outside
+template <const size_t size> inline constexpr Chunk chunk{size};
+
+/**
+ * @brief Max length of the data of the DataBuffer (property of the Log, the default is no limit): the longer data is cut to it
+ *        The trace with the data is one transaction of any output (without it the DataBuffer is allowed only for the stage outputs
+ *        and for the binary records on the gather outputs)
+ *
+ */
+struct Dump final {
+  size_t size; // Max length of the data in bytes (0 - no limit)
+};
+
+// Inline variable to use outside
+template <const size_t size> inline constexpr Dump dump{size};
+
+/**
+ * @brief Worst-case size of the traces on the output (property of the Log, the default is no limit)
+ *
+ */
+struct Budget final {
+  size_t size; // Max size of the trace (0 - no limit): the call site that can exceed it is the compile-time error
+  bool listed; // The worst-case size of each call site is placed into the non-loaded section (tools/decode.py -b prints them)
+};
+
+// Inline variable to use outside
+template <const size_t size, const bool listed = false> inline constexpr Budget budget{size, listed};
+
+/**
+ * @brief     64-bit counter of the targets without the lock-free 64-bit atomics (ARMv6/7-M: arm-none-eabi doesn't ship the libcalls,
+ *            they would take the lock in the interrupts): two 32-bit words with the separate loads and stores, the concurrent reader
+ *            might see the half of the update (the same approximation as the other counters of the traces)
+ *
+ * @tparam T  Type of the counter
+ */
+template <typename T> struct Wide final {
+  std::atomic<std::uint32_t> low{};
+  std::atomic<std::uint32_t> high{};
+
+  T load(const std::memory_order order = std::memory_order_seq_cst) const {
+    const std::uint64_t upper = high.load(order);
+    return static_cast<T>((upper << 32) | low.load(order));
+  }
+  void store(const T value, const std::memory_order order = std::memory_order_seq_cst) {
+    high.store(static_cast<std::uint32_t>(static_cast<std::uint64_t>(value) >> 32), order);
+    low.store(static_cast<std::uint32_t>(value), order);
+  }
+  T exchange(const T value, const std::memory_order order = std::memory_order_seq_cst) {
+    const auto last = load(order);
+    store(value, order);
+    return last;
+  }
+  operator T() const { return load(); }
+};
+
+// Counter that is shared by the traces: std::atomic if it is lock-free for the type, Wide otherwise
+template <typename T>
+using Shared = std::conditional_t<(sizeof(T) <= sizeof(std::uint32_t)) || std::atomic<T>::is_always_lock_free, std::atomic<T>, Wide<T>>;
+
+/**
+ * @brief     Counter value of the previous trace (for Stamp::Delta, shared by all Log objects with the same Clock)
+ *
+ * @tparam C  Clock of the Log
+ * @tparam T  Type of the counter
+ */
+template <const Clock C, typename T> inline Shared<T> previous{};
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define ISO_LOG_DWT 1
+// DWT CYCCNT of Cortex-M3 and newer (used as the cycle counter if the Output doesn't have cycles())
+namespace dwt {
+inline void enable() {
+  *reinterpret_cast<volatile std::uint32_t *>(0xE000EDFCUL) |= (1UL << 24); // DEMCR.TRCENA
+  *reinterpret_cast<volatile std::uint32_t *>(0xE0001000UL) |= 1UL;         // DWT.CTRL.CYCCNTENA
+}
+
+inline std::uint32_t cycles() { return *reinterpret_cast<volatile std::uint32_t *>(0xE0001004UL); } // DWT.CYCCNT
+} // namespace dwt
+#else
+#define ISO_LOG_DWT 0
+#endif
+
+/**
+ * @brief Cost of the call site (the level and the format string of the Log with Profile::Enabled), counted after each trace
+ *        The counters use the only relaxed loads and stores, the concurrent traces of the same call site can be counted approximately
+ *        The cycles are the difference of the cycle counter, so the preemption in the middle of the trace is counted too
+ *
+ */
+struct Cost final {
+  const char *component;                      // Name of the component
+  const char *string;                         // Format string of the call site
+  Trace level;                                // Level of the call site (Trace::None for message())
+  std::atomic<std::uint32_t> hits{};          // Quantity of the traces
+  Shared<std::uint64_t> bytes{};              // Total size of the traces on the output
+  std::atomic<std::uint32_t> maxBytes{};      // Max size of the trace
+  Shared<std::uint64_t> formatting{};         // Total cycles of the formatting (without the output)
+  std::atomic<std::uint32_t> maxFormatting{}; // Max cycles of the formatting
+  Shared<std::uint64_t> output{};             // Total cycles in the Output (puts(), write(), writev(), reserve() and commit())
+  std::atomic<std::uint32_t> maxOutput{};     // Max cycles in the Output
+  std::atomic<bool> listed{};                 // The call site is in the list
+  Cost *next = nullptr;                       // Next call site in the list
+
+  constexpr Cost(const char *c, const char *s, const Trace l) : component(c), string(s), level(l) {}
+
+  /**
+   * @brief         Count the trace and add the call site to the list with the first trace
+   *
+   * @param size    Size of the trace on the output
+   * @param cycles  Cycles of the formatting
+   * @param spent   Cycles in the Output
+   */
+  void add(const std::uint32_t size, const std::uint32_t cycles, const std::uint32_t spent);
+};
+
+// Head of the list of the call sites that have been traced at least once
+inline std::atomic<Cost *> sites{};
+
+inline void Cost::add(const std::uint32_t size, const std::uint32_t cycles, const std::uint32_t spent) {
+  const auto max = [](std::atomic<std::uint32_t> &field, const std::uint32_t value) {
+    if (value > field.load(std::memory_order_relaxed)) {
+      field.store(value, std::memory_order_relaxed);
+    }
+  };
+  hits.store(hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  bytes.store(bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+  formatting.store(formatting.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+  output.store(output.load(std::memory_order_relaxed) + spent, std::memory_order_relaxed);
+  max(maxBytes, size);
+  max(maxFormatting, cycles);
+  max(maxOutput, spent);
+  if (!listed.load(std::memory_order_relaxed) && !listed.exchange(true, std::memory_order_relaxed)) {
+    next = sites.load(std::memory_order_relaxed);
+    while (!sites.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+}
+
+/**
+ * @brief     Pass each call site that has been traced at least once (the latest traced first)
+ *
+ * @param f   Function that takes const Cost &
+ *
+ * @example   iso::log::costs([](const iso::log::Cost &cost) { if (cost.bytes > worst->bytes) worst = &cost; });
+ */
+template <typename F> inline void costs(const F &f) {
+  for (const auto *cost = sites.load(std::memory_order_acquire); nullptr != cost; cost = cost->next) {
+    f(*cost);
+  }
+}
+
+/**
+ * @brief         Cost of the call site: the only one static object for each Log type, level and format string
+ *
+ * @tparam Name   Component of the Log
+ * @tparam lvl    Level of the call site
+ * @tparam S      Format string
+ */
+template <iso::format::const_string Name, const Trace lvl, iso::format::const_string S> inline Cost cost{Name::string, S::string, lvl};
+
+/**
+ * @brief         Worst-case size of the call site in the non-loaded section: [size (4 bytes)][format string and '\0'][file:line and '\0']
+ *                The linker gathers the entries of all call sites, so the global maximum is known to size the buffers of the outputs
+ *
+ * @tparam worst  Worst-case size of the trace on the output
+ * @tparam S      Format string of the call site
+ */
+template <const size_t worst, iso::format::const_string S> struct Listed final {
+  // Source location after the string (empty for the strings without the location)
+  static constexpr auto where = []() consteval {
+    if constexpr (iso::format::located_string<S>) {
+      return iso::format::wrappers::Where<S::location>();
+    } else {
+      return iso::format::wrappers::Wrap<1>("");
+    }
+  }();
+
+  struct Entry {
+    std::uint32_t size;
+    char text[sizeof(S::string) + sizeof(where.elems)];
+  };
+
+  // The entry is not needed on the target, so it is supposed to be placed into a non-loaded section
+  [[gnu::section(".iso_length"), gnu::used]] static constexpr Entry entry = []() consteval {
+    Entry e{static_cast<std::uint32_t>(worst), {}};
+    size_t i = 0;
+    for (const auto c : S::string) {
+      e.text[i++] = c;
+    }
+    for (const auto c : where.elems) {
+      e.text[i++] = c;
+    }
+    return e;
+  }();
+};
+
+/**
+ * @brief         Output of the Log with Profile::Enabled: passes everything to the Output and counts the cycles spent in it
+ *
+ * @tparam Output The type that should be satisfied to iso::format::sink concept
+ */
+template <iso::format::sink Output> class Probe final {
+  const Output &out; // Reference to the Output object
+
+  // Add the cycles of the call to the total of the Output
+  template <typename F> inline auto measure(const F &f) const {
+    const auto start = cycles();
+    if constexpr (std::is_void_v<decltype(f())>) {
+      f();
+      spent.store(spent.load(std::memory_order_relaxed) + static_cast<std::uint32_t>(cycles() - start), std::memory_order_relaxed);
+    } else {
+      const auto result = f();
+      spent.store(spent.load(std::memory_order_relaxed) + static_cast<std::uint32_t>(cycles() - start), std::memory_order_relaxed);
+      return result;
+    }
+  }
+
+public:
+  using Wrapped = Output;                           // The binary records share the timeline of the Output (iso::format::Unwrap)
+  static inline std::atomic<std::uint32_t> spent{}; // Cycles in the Output (by all profiled Logs of this Output)
+
+  consteval Probe(const Output &o) : out(o) {}
+
+  // Cycle counter: cycles() of the Output, DWT CYCCNT otherwise
+  inline std::uint32_t cycles() const {
+    if constexpr (cycles_func<Output>) {
+      return static_cast<std::uint32_t>(out.cycles());
+    } else {
+      static_assert(cycles_func<Output> || ISO_LOG_DWT, "ERROR: The profile requires cycles() of the Output (there is no DWT CYCCNT)!");
+#if ISO_LOG_DWT
+      return dwt::cycles();
+#endif
+    }
+  }
+
+  // The same output functions as the Output has
+  inline void puts(const char *buf) const
+  requires iso::format::put<Output>
+  {
+    measure([&] { out.puts(buf); });
+  }
+  inline void write(const char *buf, const size_t size) const
+  requires iso::format::write<Output>
+  {
+    measure([&] { out.write(buf, size); });
+  }
+  inline void writev(const iso::format::Segment *segments, const size_t quantity) const
+  requires iso::format::gather<Output>
+  {
+    measure([&] { out.writev(segments, quantity); });
+  }
+  inline char *reserve(const size_t size) const
+  requires iso::format::stage<Output>
+  {
+    return measure([&] { return out.reserve(size); });
+  }
+  inline void commit(char *data, const size_t size) const
+  requires iso::format::stage<Output>
+  {
+    measure([&] { out.commit(data, size); });
+  }
+};
+
+/**
+ * @brief           Run-time threshold of the component (shared by all Log objects with the same component name)
+ *                  Trace::All by default, Trace::None disables all traces of the component (except message(...))
+ *
+ * @tparam Component The type that should be satisfied to iso::format::const_string concept
+ */
+template <iso::format::const_string Component> inline std::atomic<Trace> threshold{Trace::All};
+
+/**
+ * @brief Compile-time set of the additional Log properties (each property is a value of its own enumeration, the order doesn't matter)
+ *
+ * @tparam opts Properties, for example Encoding::Binary
+ */
+template <const auto... opts> struct LogOptions final {
+  /**
+   * @brief     Get the value of the property
+   *
+   * @tparam E  Enumeration of the property
+   * @param def Default value if the property has not been provided
+   * @return    Value of the property
+   */
+  template <typename E> static consteval E get(const E def) {
+    E value = def;
+    (
+        [&]() {
+          if constexpr (std::is_same_v<E, std::remove_cv_t<decltype(opts)>>) {
+            value = opts;
+          }
+        }(),
+        ...);
+    return value;
+  }
+  struct LogOptionsT;
+};
+
+// Inline variable to use outside
+template <const auto... opts> inline constexpr auto log_opt = LogOptions<opts...>{};
+
+// Check if type is LogOptions
+template <typename T>
+concept log_options = requires(T) { typename T::LogOptionsT; };
+
+// Check if the Output takes the traces of each level by the view of the level (iso::output::Fanout, iso::output::Batch)
+template <typename T>
+concept routed = requires(const T &t) {
+  t.template view<Trace::Info>();
+  { T::template accepts<Trace::Info> } -> std::convertible_to<bool>;
+};
+
+// Check if the Output keeps the arguments of the traces to format them later (iso::output::Defer)
+template <typename T>
+concept deferred = requires(const T &t) {
+  { t.defer(iso::format::frame<decltype(iso::format::string<"">), decltype(iso::format::string<"">)>, iso::format::string<"">) } -> std::convertible_to<size_t>;
+};
+
+// Result of the rate limit check of the call site
+struct Verdict final {
+  bool pass;           // The trace should be passed
+  unsigned suppressed; // Quantity of the suppressed traces to be reported before the trace
+};
+
+/**
+ * @brief     Rate limit of the call site: every n-th trace is passed (the 1st, the (n+1)th, ...)
+ *            All rate limits use the only relaxed loads and stores (lock-free on any core), the concurrent traces
+ *            of the same call site can be counted approximately
+ *
+ * @tparam n  Period of the passed traces
+ */
+template <const unsigned n> struct Every final {
+  static_assert(n, "ERROR: The period should be positive!");
+  static constexpr unsigned long ms = 0;
+
+  template <typename T> struct State {
+    std::atomic<unsigned> left{}; // Quantity of the traces to be suppressed till the next passed one
+  };
+
+  template <const auto window, typename T, typename Now> static inline Verdict check(State<T> &state, const Now &) {
+    const unsigned left = state.left.load(std::memory_order_relaxed);
+    state.left.store(left ? (left - 1) : (n - 1), std::memory_order_relaxed);
+    return {!left, 0};
+  }
+};
+
+/**
+ * @brief     Rate limit of the call site: only the first n traces are passed
+ *
+ * @tparam n  Quantity of the passed traces
+ */
+template <const unsigned n> struct First final {
+  static constexpr unsigned long ms = 0;
+
+  template <typename T> struct State {
+    std::atomic<unsigned> count{}; // Quantity of the passed traces
+  };
+
+  template <const auto window, typename T, typename Now> static inline Verdict check(State<T> &state, const Now &) {
+    const unsigned count = state.count.load(std::memory_order_relaxed);
+    if (count < n) {
+      state.count.store(count + 1, std::memory_order_relaxed);
+      return {true, 0};
+    }
+    return {false, 0};
+  }
+};
+
+/**
+ * @brief         Rate limit of the call site: at most k traces per time window, the quantity of the suppressed traces
+ *                is reported before the first trace of the next window
+ *
+ * @tparam k      Quantity of the passed traces in the window
+ * @tparam window Duration of the window in ms
+ */
+template <const unsigned k, const unsigned long window> struct AtMost final {
+  static_assert(k && window, "ERROR: The quantity and the window should be positive!");
+  static constexpr unsigned long ms = window;
+
+  template <typename T> struct State {
+    Shared<T> start{};                  // Counter value at the beginning of the window
+    std::atomic<unsigned> count{};      // Quantity of the passed traces in the window
+    std::atomic<unsigned> suppressed{}; // Quantity of the suppressed traces in the window
+  };
+
+  template <const auto units, typename T, typename Now> static inline Verdict check(State<T> &state, const Now &now) {
+    const T time = now();
+    if (static_cast<T>(time - state.start.load(std::memory_order_relaxed)) >= units) {
+      const unsigned suppressed = state.suppressed.load(std::memory_order_relaxed);
+      state.start.store(time, std::memory_order_relaxed);
+      state.count.store(1, std::memory_order_relaxed);
+      state.suppressed.store(0, std::memory_order_relaxed);
+      return {true, suppressed};
+    }
+    const unsigned count = state.count.load(std::memory_order_relaxed);
+    if (count < k) {
+      state.count.store(count + 1, std::memory_order_relaxed);
+      return {true, 0};
+    }
+    state.suppressed.store(state.suppressed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return {false, 0};
+  }
+};
+
+template <typename L, typename Policy, typename Site> class Limited;
+
 /**
  * @brief               Compile-time class to log information
  *
- * @tparam Output       The type that should be satisfied to time concept
+ * @tparam Output       The type that should be satisfied to iso::format::sink concept (with tick() or cycles() as the time source)
  * @tparam LogLevel     The type that should be satisfied to log_level concept (all messages below the provided log_level will be ignored)
  * @tparam Component    The type that should be satisfied to iso::format::const_string concept
  */
-template <time Output, log_level LogLevel = TraceLevel<Trace::All>, iso::format::const_string Component = decltype(iso::format::string<"">)>
+template <iso::format::sink Output, log_level LogLevel = TraceLevel<Trace::All>, iso::format::const_string Component = decltype(iso::format::string<"">),
+          log_options Options = LogOptions<>>
 class Log final {
   const Output &out;                                             // Reference to the Output object
   static constexpr Trace level = LogLevel::level;                // Logging level that has been requested
   static constexpr auto component = Component{};                 // Name of the component
   static constexpr TraceHighlight<LogLevel::colour> highlight{}; // Trace highlight
+  static constexpr Encoding encoding = Options::get(Encoding::Text);
+  static constexpr Filter filter = Options::get(Filter::Static);
+  static constexpr Profile profile = Options::get(Profile::Disabled);
+  static constexpr Location location = Options::get(Location::Hidden);
+  static constexpr Budget limit = Options::get(Budget{0, false});
+  using Sink = std::conditional_t<(Profile::Enabled == profile), Probe<Output>, Output>;
+
+  // View of the level of the routed Output
+  template <const Trace lvl> using Viewed = std::remove_cvref_t<decltype(std::declval<const Output &>().template view<lvl>())>;
+
+  // The views of all levels share the timeline of the binary records (iso::format::Unwrap)
+  template <const Trace lvl> static consteval bool shared() {
+    return std::is_same_v<typename iso::format::Unwrap<Viewed<lvl>>::type, typename iso::format::Unwrap<Viewed<Trace::None>>::type>;
+  }
+  static consteval bool stream() {
+    if constexpr (routed<Output>) {
+      return shared<Trace::Trace>() && shared<Trace::Debug>() && shared<Trace::Info>() && shared<Trace::Warn>() && shared<Trace::Error>() &&
+             shared<Trace::Fatal>();
+    } else {
+      return true;
+    }
+  }
+
+  static constexpr Clock clock = Options::get(Clock{0, Resolution::Milli, Stamp::Absolute});
+
+  static_assert((Encoding::Binary != encoding) || iso::format::write<Output>, "ERROR: The binary encoding requires write(const char *, size_t)!");
+  static_assert(clock.frequency || time_func<Output>, "ERROR: The Output should provide tick() or the cycle counter should be used!");
+  static_assert(clock.frequency || (Resolution::Milli == clock.resolution), "ERROR: The tick() supports only Resolution::Milli!");
+  static_assert(!clock.frequency || cycles_func<Output> || ISO_LOG_DWT, "ERROR: The Output should provide cycles() (there is no DWT CYCCNT)!");
+  static_assert((Profile::Disabled == profile) || cycles_func<Output> || ISO_LOG_DWT, "ERROR: The profile requires cycles() of the Output (there is no DWT CYCCNT)!");
+  static_assert(!routed<Output> || (Encoding::Text == encoding) || stream(),
+                "ERROR: The binary encoding requires one stream for all levels (the fan-out supports only the text encoding)!");
+  static_assert(!routed<Output> || (Profile::Disabled == profile), "ERROR: The profile isn't supported for the views of the levels (fan-out, batch)!");
+  static_assert(!deferred<Output> || (Encoding::Text == encoding), "ERROR: The deferred formatting supports only the text encoding!");
+  static_assert(!deferred<Output> || (Profile::Disabled == profile), "ERROR: The profile isn't supported for the deferred formatting (nothing is formatted in the trace)!");
+
+  // Current value of the counter: tick() or cycles() of the Output, DWT CYCCNT otherwise
+  inline auto counter() const {
+    if constexpr (!clock.frequency) {
+      return out.tick();
+    } else if constexpr (cycles_func<Output>) {
+      return out.cycles();
+    } else {
+#if ISO_LOG_DWT
+      return dwt::cycles();
+#endif
+    }
+  }
+
+  /**
+   * @brief         Convert the cycles to the time units by the compile-time Q64 scale (multiplications only, the error is up to 1 unit)
+   *
+   * @param cycles  Quantity of the cycles
+   * @return        Quantity of the time units (10^-resolution of the second)
+   */
+  static inline std::uint64_t scale(const std::uint64_t cycles) {
+    constexpr std::uint64_t units = [] {
+      std::uint64_t power = 1;
+      for (auto i = static_cast<unsigned>(clock.resolution); i; i--) {
+        power *= 10;
+      }
+      return power;
+    }();
+    constexpr std::uint64_t whole = units / clock.frequency;
+    // Fraction of the units per cycle in Q64 (rounded up: exact for the whole units)
+    constexpr std::uint64_t fraction = [] {
+      std::uint64_t remainder = units % clock.frequency;
+      std::uint64_t result = 0;
+      for (unsigned i = 0; i < 64; i++) {
+        remainder <<= 1;
+        result <<= 1;
+        if (remainder >= clock.frequency) {
+          remainder -= clock.frequency;
+          result |= 1;
+        }
+      }
+      return result + (remainder ? 1 : 0);
+    }();
+    return (cycles * whole) + iso::format::kernels::MultiplyHigh(cycles, fraction);
+  }
+
+  // Time mark of the trace: tick() as it is, or the cycles in the requested resolution
+  inline auto stamp() const {
+    auto now = counter();
+    if constexpr (Stamp::Delta == clock.stamp) {
+      now -= previous<clock, decltype(now)>.exchange(now, std::memory_order_relaxed);
+    }
+    if constexpr (!clock.frequency) {
+      return now;
+    } else {
+      return iso::format::Timestamp<static_cast<unsigned char>(clock.resolution)>{scale(now)};
+    }
+  }
+
+  // Run-time check of the level (always true for the static filter)
+  template <const Trace lvl> static inline bool enabled() {
+    if constexpr (Filter::Runtime == filter) {
+      return lvl >= iso::log::threshold<std::remove_cv_t<Component>>.load(std::memory_order_relaxed);
+    } else {
+      return true;
+    }
+  }
+
+  // Cycle counter and cycles in the Output before the trace (empty without the profile)
+  struct Mark {
+    std::uint32_t start;
+    std::uint32_t spent;
+  };
+  struct Nothing {};
+  inline auto mark() const {
+    if constexpr (Profile::Enabled == profile) {
+      const auto spent = Probe<Output>::spent.load(std::memory_order_relaxed);
+      return Mark{probe.cycles(), spent};
+    } else {
+      return Nothing{};
+    }
+  }
+
+  /**
+   * @brief         Count the cost of the trace for the call site (nothing is counted without the profile)
+   *
+   * @tparam lvl    Level of the trace
+   * @tparam S      Format string of the call site
+   * @param before  Mark before the trace
+   * @param size    Size of the trace on the output
+   */
+  template <const Trace lvl, typename S, typename M> inline void count(const M before, const size_t size) const {
+    if constexpr (Profile::Enabled == profile) {
+      const auto cycles = static_cast<std::uint32_t>(probe.cycles() - before.start);
+      const auto output = static_cast<std::uint32_t>(Probe<Output>::spent.load(std::memory_order_relaxed) - before.spent);
+      cost<std::remove_cv_t<Component>, lvl, S>.add(static_cast<std::uint32_t>(size), (cycles > output) ? (cycles - output) : 0, output);
+    }
+  }
+
+  // String of the call site with the source location of iso::format::located (if any), for the binary descriptor
+  template <typename S, typename T> static consteval auto locate(const T) {
+    if constexpr (iso::format::located_string<S>) {
+      return iso::format::wrappers::Located<T::instance, S::location>{};
+    } else {
+      return T{};
+    }
+  }
+
+  // String of the call site as it is: iso::format::string and located are passed without the new string (the others are converted)
+  template <typename S> static consteval auto own() {
+    if constexpr (requires { S::instance; }) {
+      return std::remove_cv_t<S>{};
+    } else {
+      return locate<S>(iso::format::string<S::string>);
+    }
+  }
+
+  // Text of the call site: "file:line " is placed before it for Location::Prefix and iso::format::located
+  template <typename S> static consteval auto text() {
+    using namespace iso::format;
+    if constexpr ((Location::Prefix == location) && located_string<S>) {
+      return wrappers::String<wrappers::Where<S::location>()>{} + string<" "> + wrappers::String<S::instance>{};
+    } else if constexpr (requires { S::instance; }) {
+      return wrappers::String<S::instance>{};
+    } else {
+      return string<S::string>;
+    }
+  }
+
+  // Prefix of the traces of the level: the highlight, time mark, name of the level and component
+  template <const Trace lvl> static consteval auto prefix() {
+    using namespace iso::format;
+    if constexpr (Trace::Fatal == lvl) {
+      return string<highlight.cyan> + string<"[%t] FATAL "> + component + string<": ">;
+    } else if constexpr (Trace::Error == lvl) {
+      return string<highlight.red> + string<"[%t] ERROR "> + component + string<": ">;
+    } else if constexpr (Trace::Warn == lvl) {
+      return string<highlight.yellow> + string<"[%t] WARN "> + component + string<": ">;
+    } else if constexpr (Trace::Info == lvl) {
+      return string<"[%t] INFO "> + component + string<": ">;
+    } else if constexpr (Trace::Debug == lvl) {
+      return string<"[%t] DEBUG "> + component + string<": ">;
+    } else if constexpr (Trace::Trace == lvl) {
+      return string<"[%t] TRACE "> + component + string<": ">;
+    } else {
+      return string<"[%t] MESSAGE "> + component + string<": ">;
+    }
+  }
+
+  // End of the traces of the level (the highlight is reset after the highlighted levels)
+  template <const Trace lvl> static consteval auto suffix() {
+    using namespace iso::format;
+    if constexpr ((Trace::Fatal == lvl) || (Trace::Error == lvl) || (Trace::Warn == lvl)) {
+      return string<highlight.def>;
+    } else {
+      return string<"">;
+    }
+  }
+
+  /**
+   * @brief         Worst-case size of the trace on the output: the text line with the time mark and the end, the binary record with the end
+   *                The data of the DataBuffer is counted only with iso::log::dump (its max length)
+   *
+   * @tparam dumped The trace with the DataBuffer
+   * @tparam P      Compile time string with the time mark, level and component
+   * @tparam S      Compile time string string with the specifiers to be formatted
+   * @tparam E      Compile time string that should be passed after string
+   * @tparam Args   Argument types
+   * @return        Size of the trace in bytes
+   */
+  template <const bool dumped, typename P, typename S, typename E, typename... Args> static consteval size_t Worst() {
+    using namespace iso::format;
+    using F = Format<Sink, Options::get(Chunk{0}).size, Options::get(Dump{0}).size>;
+    using Time = decltype(std::declval<const Log &>().stamp());
+    if constexpr (Encoding::Binary == encoding) {
+      using Joined = decltype(string<P::string> + string<S::string>);
+      if constexpr (dumped) {
+        return F::template bytes<Joined, Time, Args...> + F::dump + Options::get(Dump{0}).size + ((sizeof(E::string) > 1) ? sizeof(std::uint32_t) : 0);
+      } else {
+        return F::template bytes<Joined, Time, Args...>;
+      }
+    } else {
+      return F::template length<P, Time> + F::template length<decltype(text<S>()), Args...> + sizeof(E::string) - 1 + (dumped ? F::hexed : 2);
+    }
+  }
+
+  // Compile-time check of the worst-case size of the call site by the budget (and its entry in the list for Budget::listed)
+  template <const bool dumped, typename P, typename S, typename E, typename... Args> static inline void check() {
+    constexpr size_t worst = Worst<dumped, P, S, E, Args...>();
+    static_assert(!limit.size || (worst <= limit.size), "ERROR: The trace can exceed the budget of the Log (iso::log::budget)!");
+    if constexpr (limit.listed) {
+      (void)Listed<worst, S>::entry;
+    }
+  }
+
+  // Size of the text trace on the output (printf returns the length with '\0', 0 - the trace has been dropped)
+  static constexpr size_t Written(const size_t symbols) { return symbols ? (symbols - 1) : 0; }
+
+  /**
+   * @brief         Pass the line with time mark in the requested encoding
+   *                The prefix and the end are the same for all call sites of the level, so they are shared in the memory
+   *
+   * @tparam lvl    Level of the trace (Trace::None - without relation to the level)
+   * @param P       Compile time string with the time mark, level and component
+   * @param S       Compile time string string with the specifiers to be formatted
+   * @param E       Compile time string that should be passed after string
+   * @param args    Variables that should be formatted and placed inside string
+   */
+  template <const Trace lvl, iso::format::const_string P, iso::format::const_string S, iso::format::const_string E, typename... Args>
+  inline void line(const P, const S, const E, const Args... args) const {
+    using namespace iso::format;
+    if constexpr (accepted<lvl>) {
+      check<false, P, S, E, Args...>();
+      if (!enabled<lvl>()) {
+        return;
+      }
+      constexpr auto end = string<E::string> + string<"\r\n">;
+      const auto before = mark();
+      if constexpr (Encoding::Binary == encoding) {
+        count<lvl, S>(before, formatter<lvl>().record(locate<S>(string<P::string> + string<S::string> + end), stamp(), args...));
+      } else if constexpr (deferred<Output>) {
+        count<lvl, S>(before, out.defer(frame<P, std::remove_cv_t<decltype(end)>>, text<S>(), stamp(), args...));
+      } else {
+        count<lvl, S>(before, Written(formatter<lvl>().printf(frame<P, std::remove_cv_t<decltype(end)>>, text<S>(), stamp(), args...)));
+      }
+    }
+  }
+
+  // Overload for the constant arguments: the string is formatted in the compile-time, the only time mark is formatted in the run-time
+  template <const Trace lvl, iso::format::const_string P, iso::format::const_string S, iso::format::const_string E, typename... Args>
+  requires iso::format::is_folded_v<Args...>
+  inline void line(const P, const S, const E, const Args...) const {
+    line<lvl>(P{}, locate<S>(decltype(format)::fold(S{}, Args{}...)), E{});
+  }
+
+  /**
+   * @brief             Pass the buffer with time mark in the requested encoding
+   *
+   * @tparam lvl        Level of the trace (Trace::None - without relation to the level)
+   * @tparam P          Compile time string with the time mark, level and component
+   * @tparam S          Compile time string string with the specifiers to be formatted
+   * @tparam E          Compile time string that should be passed after buffer
+   * @param dataBuffer  Object with dynamic data
+   * @param args        Variables that should be formatted and placed inside string
+   */
+  template <const Trace lvl, iso::format::const_string P, iso::format::const_string S, iso::format::const_string E, typename... Args>
+  inline void dump(const P, const S, const E, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
+    using namespace iso::format;
+    if constexpr (accepted<lvl>) {
+      static_assert(whole<lvl>, "ERROR: The trace with the DataBuffer is one transaction of this output only with the max length of the data (iso::log::dump)!");
+      check<true, P, S, E, Args...>();
+      if (!enabled<lvl>()) {
+        return;
+      }
+      const auto before = mark();
+      if constexpr (Encoding::Binary == encoding) {
+        count<lvl, S>(before, formatter<lvl>().record(frame<P, E>, S{}, dataBuffer, stamp(), args...));
+      } else if constexpr (deferred<Output>) {
+        count<lvl, S>(before, out.defer(frame<P, E>, text<S>(), dataBuffer, stamp(), args...));
+      } else {
+        count<lvl, S>(before, Written(formatter<lvl>().printf(frame<P, E>, text<S>(), dataBuffer, stamp(), args...)));
+      }
+    }
+  }
+
+  // Overload for the constant arguments (the same as for line())
+  template <const Trace lvl, iso::format::const_string P, iso::format::const_string S, iso::format::const_string E, typename... Args>
+  requires iso::format::is_folded_v<Args...>
+  inline void dump(const P, const S, const E end, const iso::format::DataBuffer &dataBuffer, const Args...) const {
+    dump<lvl>(P{}, locate<S>(decltype(format)::fold(S{}, Args{}...)), end, dataBuffer);
+  }
+
+  template <typename L, typename Policy, typename Site> friend class Limited;
+
+  // Nothing is placed between the format and the Output without the profile
+  struct Direct {
+    consteval Direct(const Output &) {}
+  };
+  [[no_unique_address]] const std::conditional_t<(Profile::Enabled == profile), Probe<Output>, Direct> probe; // Output of the format for the profile
+
+  // Formats of the levels for the fan-out: the trace is formatted once into the view of its level (all outputs of the level share it)
+  template <const Trace lvl> using Via = iso::format::Format<Viewed<lvl>, Options::get(Chunk{0}).size, Options::get(Dump{0}).size>;
+  struct Routes {
+    const Via<Trace::Trace> trace;
+    const Via<Trace::Debug> debug;
+    const Via<Trace::Info> info;
+    const Via<Trace::Warn> warn;
+    const Via<Trace::Error> error;
+    const Via<Trace::Fatal> fatal;
+    const Via<Trace::None> none;
+    consteval Routes(const Output &o)
+        : trace(o.template view<Trace::Trace>()), debug(o.template view<Trace::Debug>()), info(o.template view<Trace::Info>()),
+          warn(o.template view<Trace::Warn>()), error(o.template view<Trace::Error>()), fatal(o.template view<Trace::Fatal>()),
+          none(o.template view<Trace::None>()) {}
+  };
+  [[no_unique_address]] const std::conditional_t<routed<Output>, Routes, Direct> routes;
+
+  // At least one output accepts the level (always for the single Output)
+  template <const Trace lvl> static constexpr bool accepted = [] {
+    if constexpr (routed<Output>) {
+      return Output::template accepts<lvl>;
+    } else {
+      return true;
+    }
+  }();
+
+  // The trace with the DataBuffer is one transaction of the output of the level: the data is bounded (Defer checks its own Output),
+  // the output takes the reservation for the whole trace or the binary record with the data by one writev()
+  template <typename T> static constexpr bool taken = iso::format::stage<T> || ((Encoding::Binary == encoding) && iso::format::gather<T>);
+  template <const Trace lvl> static constexpr bool whole = [] {
+    if constexpr (Options::get(Dump{0}).size || deferred<Output>) {
+      return true;
+    } else if constexpr (routed<Output>) {
+      return taken<Viewed<lvl>>;
+    } else {
+      return taken<Sink>;
+    }
+  }();
+
+  // Format of the level: the view of the level for the fan-out, the common format otherwise
+  template <const Trace lvl> constexpr const auto &formatter() const {
+    if constexpr (!routed<Output>) {
+      return format;
+    } else if constexpr (Trace::Trace == lvl) {
+      return routes.trace;
+    } else if constexpr (Trace::Debug == lvl) {
+      return routes.debug;
+    } else if constexpr (Trace::Info == lvl) {
+      return routes.info;
+    } else if constexpr (Trace::Warn == lvl) {
+      return routes.warn;
+    } else if constexpr (Trace::Error == lvl) {
+      return routes.error;
+    } else if constexpr (Trace::Fatal == lvl) {
+      return routes.fatal;
+    } else {
+      return routes.none;
+    }
+  }
+
+  // Output of the format: Probe for the profile, the Output itself otherwise
+  constexpr const Sink &sink() const {
+    if constexpr (Profile::Enabled == profile) {
+      return probe;
+    } else {
+      return out;
+    }
+  }
 
 public:
-  const iso::format::Format<Output> format; // The compile time format object (just to provide access if needed)
+  const iso::format::Format<Sink, Options::get(Chunk{0}).size, Options::get(Dump{0}).size> format; // The compile time format object (just to provide access if needed)
 
   /**
    * @brief           Compile-time constructors with the only one mandatory parameter
@@ -136,14 +997,52 @@ public:
    * @param o         Reference to the Output class object
    * @param LogLevel  Level of tracing, the functions for level lower than provided transform to empty
    * @param Component Name of the component
+   * @param Options   Additional properties (LogOptions)
    *
    * @example         static constexpr iso::log::Log debug{debugPuts, format::string<"UART">};
    * @example         static constexpr iso::log::Log debug{debugPuts, log::log_lvl<log::Trace::Warn>, format::string<"GLOBAL">};
+   * @example         static constexpr iso::log::Log debug{debugPuts, format::string<"UDP">, log::log_opt<log::Encoding::Binary>};
+   */
+  consteval Log(const Output &o) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const LogLevel) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const Component) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const LogLevel, const Component) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const Options) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const LogLevel, const Options) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const Component, const Options) : out(o), probe(o), routes(o), format(sink()) {}
+  consteval Log(const Output &o, const LogLevel, const Component, const Options) : out(o), probe(o), routes(o), format(sink()) {}
+
+  /**
+   * @brief       Worst-case size of the trace of the level on the output to size the buffers in the compile-time
+   *              (the text line with the end or the binary record, the data of the DataBuffer isn't counted)
+   *
+   * @tparam lvl  Level of the trace (Trace::None for message(...))
+   * @tparam S    String type
+   * @tparam Args Argument types
+   *
+   * @example     static_assert(decltype(debug)::length<iso::log::Trace::Info, decltype(iso::format::string<"sent %u">), unsigned> <= 64);
+   */
+  template <const Trace lvl, iso::format::const_string S, typename... Args>
+  static constexpr size_t length = Worst<false, decltype(prefix<lvl>()), S, decltype(suffix<lvl>()), Args...>();
+
+  /**
+   * @brief     Set the run-time threshold of the component (for Filter::Runtime, the compile-time LogLevel is still applied)
+   *
+   * @param lvl Level of tracing, the traces with level lower than provided are skipped before any formatting
+   *
+   * @example   debug.threshold(iso::log::Trace::Warn);
+   */
+  static void threshold(const Trace lvl) {
+    static_assert(Filter::Runtime == filter, "ERROR: The run-time threshold requires Filter::Runtime option!");
+    iso::log::threshold<std::remove_cv_t<Component>>.store(lvl, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief   Get the run-time threshold of the component
+   *
+   * @return  Current threshold
    */
-  consteval Log(const Output &o) : out(o), format(o) {}
-  consteval Log(const Output &o, const LogLevel = LogLevel{}) : out(o), format(o) {}
-  consteval Log(const Output &o, const Component = Component{}) : out(o), format(o) {}
-  consteval Log(const Output &o, const LogLevel = LogLevel{}, const Component = Component{}) : out(o), format(o) {}
+  static Trace threshold() { return iso::log::threshold<std::remove_cv_t<Component>>.load(std::memory_order_relaxed); }
 
   /**
    * @brief         Function to print line with time mark
@@ -153,8 +1052,7 @@ public:
    */
   template <iso::format::const_string S, typename... Args> inline void message(const S, const Args... args) const {
     using namespace iso::format;
-    constexpr auto res_str = string<"[%t] MESSAGE "> + component + string<": "> + string<S::string>;
-    format.println(res_str, out.tick(), args...);
+    line<Trace::None>(prefix<Trace::None>(), own<S>(), suffix<Trace::None>(), args...);
   }
 
   /**
@@ -167,8 +1065,7 @@ public:
   template <iso::format::const_string S, typename... Args>
   inline void message(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
-    constexpr auto res_str = string<"[%t] MESSAGE "> + component + string<": "> + string<S::string>;
-    format.printf(res_str, dataBuffer, out.tick(), args...);
+    dump<Trace::None>(prefix<Trace::None>(), own<S>(), suffix<Trace::None>(), dataBuffer, args...);
   }
 
   /**
@@ -180,8 +1077,7 @@ public:
   template <iso::format::const_string S, typename... Args> inline void fatal(const S, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Fatal >= level) {
-      constexpr auto res_str = string<highlight.cyan> + string<"[%t] FATAL "> + component + string<": "> + string<S::string> + string<highlight.def>;
-      format.println(res_str, out.tick(), args...);
+      line<Trace::Fatal>(prefix<Trace::Fatal>(), own<S>(), suffix<Trace::Fatal>(), args...);
     }
   }
 
@@ -196,9 +1092,7 @@ public:
   inline void fatal(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Fatal >= level) {
-      constexpr auto res_str = string<highlight.cyan> + string<"[%t] FATAL "> + component + string<": "> + string<S::string>;
-      format.printf(res_str, dataBuffer, out.tick(), args...);
-      format.printf(string<highlight.def>);
+      dump<Trace::Fatal>(prefix<Trace::Fatal>(), own<S>(), suffix<Trace::Fatal>(), dataBuffer, args...);
     }
   }
 
@@ -211,8 +1105,7 @@ public:
   template <iso::format::const_string S, typename... Args> inline void error(const S, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Error >= level) {
-      constexpr auto res_str = string<highlight.red> + string<"[%t] ERROR "> + component + string<": "> + string<S::string> + string<highlight.def>;
-      format.println(res_str, out.tick(), args...);
+      line<Trace::Error>(prefix<Trace::Error>(), own<S>(), suffix<Trace::Error>(), args...);
     }
   }
 
@@ -227,9 +1120,7 @@ public:
   inline void error(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Error >= level) {
-      constexpr auto res_str = string<highlight.red> + string<"[%t] ERROR "> + component + string<": "> + string<S::string>;
-      format.printf(res_str, dataBuffer, out.tick(), args...);
-      format.printf(string<highlight.def>);
+      dump<Trace::Error>(prefix<Trace::Error>(), own<S>(), suffix<Trace::Error>(), dataBuffer, args...);
     }
   }
 
@@ -242,8 +1133,7 @@ public:
   template <iso::format::const_string S, typename... Args> inline void warning(const S, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Warn >= level) {
-      constexpr auto res_str = string<highlight.yellow> + string<"[%t] WARN "> + component + string<": "> + string<S::string> + string<highlight.def>;
-      format.println(res_str, out.tick(), args...);
+      line<Trace::Warn>(prefix<Trace::Warn>(), own<S>(), suffix<Trace::Warn>(), args...);
     }
   }
 
@@ -258,9 +1148,7 @@ public:
   inline void warning(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Warn >= level) {
-      constexpr auto res_str = string<highlight.yellow> + string<"[%t] WARN "> + component + string<": "> + string<S::string>;
-      format.printf(res_str, dataBuffer, out.tick(), args...);
-      format.printf(string<highlight.def>);
+      dump<Trace::Warn>(prefix<Trace::Warn>(), own<S>(), suffix<Trace::Warn>(), dataBuffer, args...);
     }
   }
 
@@ -273,8 +1161,7 @@ public:
   template <iso::format::const_string S, typename... Args> inline void info(const S, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Info >= level) {
-      constexpr auto res_str = string<"[%t] INFO "> + component + string<": "> + string<S::string>;
-      format.println(res_str, out.tick(), args...);
+      line<Trace::Info>(prefix<Trace::Info>(), own<S>(), suffix<Trace::Info>(), args...);
     }
   }
 
@@ -289,8 +1176,7 @@ public:
   inline void info(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Info >= level) {
-      constexpr auto res_str = string<"[%t] INFO "> + component + string<": "> + string<S::string>;
-      format.printf(res_str, dataBuffer, out.tick(), args...);
+      dump<Trace::Info>(prefix<Trace::Info>(), own<S>(), suffix<Trace::Info>(), dataBuffer, args...);
     }
   }
 
@@ -303,8 +1189,7 @@ public:
   template <iso::format::const_string S, typename... Args> inline void debug(const S, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Debug >= level) {
-      constexpr auto res_str = string<"[%t] DEBUG "> + component + string<": "> + string<S::string>;
-      format.println(res_str, out.tick(), args...);
+      line<Trace::Debug>(prefix<Trace::Debug>(), own<S>(), suffix<Trace::Debug>(), args...);
     }
   }
 
@@ -319,8 +1204,7 @@ public:
   inline void debug(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Debug >= level) {
-      constexpr auto res_str = string<"[%t] DEBUG "> + component + string<": "> + string<S::string>;
-      format.printf(res_str, dataBuffer, out.tick(), args...);
+      dump<Trace::Debug>(prefix<Trace::Debug>(), own<S>(), suffix<Trace::Debug>(), dataBuffer, args...);
     }
   }
 
@@ -333,8 +1217,7 @@ public:
   template <iso::format::const_string S, typename... Args> inline void trace(const S, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Trace >= level) {
-      constexpr auto res_str = string<"[%t] TRACE "> + component + string<": "> + string<S::string>;
-      format.println(res_str, out.tick(), args...);
+      line<Trace::Trace>(prefix<Trace::Trace>(), own<S>(), suffix<Trace::Trace>(), args...);
     }
   }
 
@@ -349,10 +1232,137 @@ public:
   inline void trace(const S, const iso::format::DataBuffer &dataBuffer, const Args... args) const {
     using namespace iso::format;
     if constexpr (Trace::Trace >= level) {
-      constexpr auto res_str = string<"[%t] TRACE "> + component + string<": "> + string<S::string>;
-      format.printf(res_str, dataBuffer, out.tick(), args...);
+      dump<Trace::Trace>(prefix<Trace::Trace>(), own<S>(), suffix<Trace::Trace>(), dataBuffer, args...);
+    }
+  }
+};
+
+/**
+ * @brief     Pass the cost of each call site by message() of the Log (the output of the report is counted too for the profiled Log)
+ *
+ * @param log Log object
+ *
+ * @example   iso::log::report(debug); // [12.345] MESSAGE GLOBAL: INFO UART/"sent %u": hits 10, bytes 320 (max 32), ...
+ */
+template <typename L> inline void report(const L &log) {
+  using namespace iso::format;
+  static constexpr char const *levels[] = {"ALL", "TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL", "NONE"};
+  costs([&](const Cost &c) {
+    log.message(string<"%.5s %.16s/\"%.48s\": hits %u, bytes %u (max %u), format %u cycles (max %u), output %u cycles (max %u)">,
+                levels[static_cast<unsigned>(c.level)], c.component, c.string, c.hits.load(std::memory_order_relaxed),
+                c.bytes.load(std::memory_order_relaxed), c.maxBytes.load(std::memory_order_relaxed), c.formatting.load(std::memory_order_relaxed),
+                c.maxFormatting.load(std::memory_order_relaxed), c.output.load(std::memory_order_relaxed), c.maxOutput.load(std::memory_order_relaxed));
+  });
+}
+
+/**
+ * @brief         Rate-limited access to the Log methods (the state is static and unique for each call site)
+ *
+ * @tparam L      Type of the Log
+ * @tparam Policy Rate limit (Every, First, AtMost)
+ * @tparam Site   Unique type of the call site
+ */
+template <typename L, typename Policy, typename Site> class Limited final {
+  using Counter = decltype(std::declval<const L &>().counter());
+  static inline typename Policy::template State<Counter> state{};
+  // Window of the policy in the counter units (ms of tick() or cycles), it should be less than the half of the counter range
+  static constexpr std::uint64_t units = L::clock.frequency ? (static_cast<std::uint64_t>(Policy::ms) * L::clock.frequency / 1000) : Policy::ms;
+  static_assert(units < (1ULL << (8 * sizeof(Counter) - 1)),
+                "ERROR: The window of the rate limit doesn't fit into the half of the counter range (use tick() for the long windows)!");
+  static constexpr Counter window = static_cast<Counter>(units);
+  const L &log;
+
+  // Check of the call site, the quantity of the suppressed traces is reported by the same method before the trace
+  // (the traces that are filtered out by the Log don't use up the quota of the policy)
+  template <const Trace lvl, typename Summary> inline bool pass(const Summary &summary) const {
+    if constexpr (!L::template accepted<lvl>) {
+      return false;
+    }
+    if (!L::template enabled<lvl>()) {
+      return false;
+    }
+    const auto verdict = Policy::template check<window>(state, [this] { return log.counter(); });
+    if (verdict.suppressed) {
+      summary(iso::format::string<"suppressed %u messages">, verdict.suppressed);
+    }
+    return verdict.pass;
+  }
+
+public:
+  constexpr Limited(const L &l) : log(l) {}
+
+  // The same as Log methods (including DataBuffer overloads), the suppressed traces are not formatted
+  template <typename... Args> inline void message(const Args &...args) const {
+    if (pass<Trace::None>([this](const auto... s) { log.message(s...); })) {
+      log.message(args...);
+    }
+  }
+  template <typename... Args> inline void fatal(const Args &...args) const {
+    if constexpr (Trace::Fatal >= L::level) {
+      if (pass<Trace::Fatal>([this](const auto... s) { log.fatal(s...); })) {
+        log.fatal(args...);
+      }
+    }
+  }
+  template <typename... Args> inline void error(const Args &...args) const {
+    if constexpr (Trace::Error >= L::level) {
+      if (pass<Trace::Error>([this](const auto... s) { log.error(s...); })) {
+        log.error(args...);
+      }
+    }
+  }
+  template <typename... Args> inline void warning(const Args &...args) const {
+    if constexpr (Trace::Warn >= L::level) {
+      if (pass<Trace::Warn>([this](const auto... s) { log.warning(s...); })) {
+        log.warning(args...);
+      }
+    }
+  }
+  template <typename... Args> inline void info(const Args &...args) const {
+    if constexpr (Trace::Info >= L::level) {
+      if (pass<Trace::Info>([this](const auto... s) { log.info(s...); })) {
+        log.info(args...);
+      }
+    }
+  }
+  template <typename... Args> inline void debug(const Args &...args) const {
+    if constexpr (Trace::Debug >= L::level) {
+      if (pass<Trace::Debug>([this](const auto... s) { log.debug(s...); })) {
+        log.debug(args...);
+      }
+    }
+  }
+  template <typename... Args> inline void trace(const Args &...args) const {
+    if constexpr (Trace::Trace >= L::level) {
+      if (pass<Trace::Trace>([this](const auto... s) { log.trace(s...); })) {
+        log.trace(args...);
+      }
     }
   }
 };
 
-}; // namespace iso::log
\ No newline at end of file
+/**
+ * @brief         Rate-limited traces of the call site: every n-th, the first n, at most k per window in ms
+ *                The check is a few loads and stores of the static state, the suppressed traces are not formatted
+ *                The window of atMost should be less than the half of the counter range: about 12.7 s for the 32-bit cycles
+ *                at 168 MHz (the longer windows need the Log with tick())
+ *
+ * @tparam Site   Unique type of the call site (shouldn't be provided)
+ * @param log     Log object
+ * @return        Object with the same trace methods
+ *
+ * @example       iso::log::every<16>(debug).error(iso::format::string<"overrun %u">, count);
+ * @example       iso::log::first<3>(debug).warning(iso::format::string<"no response">);
+ * @example       iso::log::atMost<5, 1000>(debug).error(iso::format::string<"fault %X">, code); // "suppressed N messages" when the window reopens
+ */
+template <const unsigned n, typename Site = decltype([] {}), typename L> constexpr auto every(const L &log) {
+  return Limited<L, Every<n>, Site>{log};
+}
+template <const unsigned n, typename Site = decltype([] {}), typename L> constexpr auto first(const L &log) {
+  return Limited<L, First<n>, Site>{log};
+}
+template <const unsigned k, const unsigned long ms, typename Site = decltype([] {}), typename L> constexpr auto atMost(const L &log) {
+  return Limited<L, AtMost<k, ms>, Site>{log};
+}
+
+}; // namespace iso::log
@@ -0,0 +1,176 @@
+/**
+ * @file    pingpong.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The lock-free state of two buffers for the double-buffered outputs (Dma, Batch):
+ *          the lines are reserved in the filled buffer while the other one is passed.
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief     Lock-free states of two buffers: the writers reserve the place in the filled buffer, the owner of the transmission
+ *            seals the buffer with the lines and releases it after the transmission. The writer that has read the index of the filled
+ *            buffer before the swap might reserve the place in the other buffer (it is released, so the state is the same as before),
+ *            so seal() takes the other buffer too when the filled one is empty: the line is never left behind
+ *
+ * @tparam N  Size of each buffer in bytes
+ */
+template <const size_t N> class PingPong final {
+  static_assert(N && (N < (1UL << 23)), "ERROR: The size of the buffer should be less than 8 MiB!");
+
+  // The state of the buffer: [sealed][writers][length]
+  static constexpr std::uint32_t sealed = 0x80000000UL; // The buffer is passed (or about to be), no one can write in it
+  static constexpr std::uint32_t writer = 0x01000000UL; // One writer that copies the line into the buffer
+  static constexpr std::uint32_t writers = 0x7F000000UL;
+  static constexpr std::uint32_t length = 0x00FFFFFFUL;
+
+  mutable std::atomic<std::uint32_t> states[2]{}; // States of the buffers
+  mutable std::atomic<unsigned> fill{};           // Index of the buffer that is filled now
+
+  // The buffer has the lines and nobody is writing to it
+  static constexpr bool ready(const std::uint32_t state) { return (state & length) && !(state & (writers | sealed)); }
+
+public:
+  /**
+   * @brief   Index of the buffer that is filled now
+   *
+   * @return  Index of the buffer (0 or 1)
+   */
+  unsigned current() const { return fill.load(std::memory_order_acquire); }
+
+  /**
+   * @brief         Reserve the place for the line in the buffer (commit() should be called after the copy)
+   *
+   * @param index   Index of the buffer
+   * @param size    Length of the line
+   * @param offset  Offset of the reserved place in the buffer
+   * @return        True if the place has been reserved, false - the buffer is sealed or full
+   */
+  bool reserve(const unsigned index, const size_t size, size_t &offset) const {
+    auto current = states[index].load(std::memory_order_relaxed);
+    while (!(current & sealed) && (((current & length) + size) <= N)) {
+      if (states[index].compare_exchange_weak(current, current + writer + size, std::memory_order_acquire)) {
+        offset = current & length;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief       The line has been copied into the reserved place
+   *
+   * @param index Index of the buffer
+   */
+  void commit(const unsigned index) const { states[index].fetch_sub(writer, std::memory_order_release); }
+
+  /**
+   * @brief       Release the unused rest of the reserved place if nothing has been reserved after it (before commit())
+   *
+   * @param index Index of the buffer
+   * @param end   End of the reserved place
+   * @param rest  Length of the unused rest
+   * @return      True if the rest has been released, false - the rest stays in the buffer
+   */
+  bool shrink(const unsigned index, const size_t end, const size_t rest) const {
+    auto current = states[index].load(std::memory_order_relaxed);
+    while ((current & length) == end) {
+      if (states[index].compare_exchange_weak(current, current - rest, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief       Seal the buffer with the lines: the filled one (the writers continue in the other one) or the other one with the late line
+   *              (should be called only by the owner of the transmission, while no buffer is passed)
+   *
+   * @param index Index of the sealed buffer
+   * @return      Length of the lines in the sealed buffer (0 - nothing to pass or the writers haven't finished yet: the last one
+   *              starts the transmission after the copy)
+   */
+  size_t seal(unsigned &index) const {
+    const auto filled = fill.load(std::memory_order_relaxed);
+    for (const auto i : {filled, filled ^ 1U}) {
+      auto current = states[i].load(std::memory_order_acquire);
+      while (ready(current)) {
+        if (states[i].compare_exchange_weak(current, current | sealed, std::memory_order_acquire)) {
+          if (i == filled) {
+            fill.store(i ^ 1U, std::memory_order_release);
+          }
+          index = i;
+          return current & length;
+        }
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief       Release the passed buffer, the writers can use it again
+   *
+   * @param index Index of the buffer
+   */
+  void release(const unsigned index) const { states[index].store(0, std::memory_order_release); }
+
+  /**
+   * @brief       Length of the lines in the buffer (the reserved places are included)
+   *
+   * @param index Index of the buffer
+   * @return      Length of the lines
+   */
+  size_t size(const unsigned index) const { return states[index].load(std::memory_order_relaxed) & length; }
+
+  /**
+   * @brief   Any buffer has the writers that copy the lines
+   *
+   * @return  True if the last writer passes the buffer after the copy
+   */
+  bool writing() const { return (states[0].load(std::memory_order_acquire) | states[1].load(std::memory_order_acquire)) & writers; }
+
+  /**
+   * @brief   Any buffer has the lines that can be sealed (the last writer might have tried to start the transmission while it was busy)
+   *
+   * @return  True if seal() should be repeated
+   */
+  bool pending() const { return ready(states[0].load(std::memory_order_acquire)) || ready(states[1].load(std::memory_order_acquire)); }
+};
+
+} // namespace iso::output
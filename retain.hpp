@@ -0,0 +1,343 @@
+/**
+ * @file    retain.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The post-mortem output: the last lines (or binary records) are kept in the RAM
+ *          that survives the reset (.noinit), and passed to the real output on the next boot.
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+
+#include "log.hpp"
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief     The memory of the retained lines, it should be placed into the section that isn't initialized by the startup code
+ *            Each line is saved as [header][data][CRC][footer], both marks contain the footprint and the length of the line,
+ *            so the lines can be walked back from the end and passed in the order after the reset (the CRC covers the data)
+ *            The end of the committed lines is saved in two checkpoints with the CRC by turns of the commits
+ *            (the one that is broken by the reset is skipped, the other one has the previous commit)
+ *
+ * @tparam N  Size of the ring in bytes (should be a power of 2)
+ *
+ * @example   [[gnu::section(".noinit")]] static iso::output::Retained<4096> retained;
+ */
+template <const size_t N> struct Retained {
+  static_assert((N >= 4 * sizeof(std::uint32_t)) && (N <= (1UL << 17)) && !(N & (N - 1)),
+                "ERROR: The size of the retained ring should be a power of 2 and not more than 128 KiB!");
+
+  std::uint32_t magic;                            // The memory has been initialized by the Retain
+  std::uint32_t head;                             // Position of the next reservation
+  std::uint32_t reach;                            // The furthest end of the reservations that have been released (the old lines are broken there)
+  std::uint32_t commits;                          // Quantity of the commits (the checkpoints are saved by turns)
+  std::uint32_t checkpoints[2][2];                // [end of the committed lines][CRC of the magic and the end]
+  std::uint32_t words[N / sizeof(std::uint32_t)]; // The ring itself (word-aligned headers)
+};
+
+/**
+ * @brief           Lock-free ring in the retained RAM that is used as an output for the traces (iso::format::stage concept)
+ *                  puts()/write()/reserve() only copy the line to the RAM and overwrite the oldest ones, nothing is passed to the link,
+ *                  flush() passes the lines that have survived the reset (HardFault, watchdog) to the real output on the next boot
+ *
+ * @tparam Output   The type that should be satisfied to iso::format::sink concept (real output - RTT, UART, et cetera)
+ * @tparam N        Size of the ring in bytes (should be a power of 2)
+ *
+ * @example         [[gnu::section(".noinit")]] static iso::output::Retained<4096> retained;
+ * @example         static iso::output::Retain<DebugPuts, 4096> crash{retained, debugPuts};
+ * @example         static constexpr iso::log::Log debug{crash, iso::log::log_lvl<iso::log::Trace::Debug>, iso::format::string<"MAIN">};
+ * @example         crash.flush(); // At the start of main(), before any trace
+ */
+template <iso::format::sink Output, const size_t N> class Retain final {
+  static constexpr std::uint32_t key = 0x52544E31UL;  // Magic of the initialized memory ("RTN1")
+  static constexpr std::uint32_t empty = 0xFFFFUL;    // The length of the padding and of the line that isn't committed
+  static constexpr size_t overhead = 3 * sizeof(std::uint32_t); // Header, CRC and footer of the line
+
+  Retained<N> &memory; // Reference to the retained memory
+  const Output &out;   // Reference to the real Output object
+
+  // Step of the CRC-32 (IEEE 802.3) with the nibble table (small enough to be calculated on each commit)
+  static std::uint32_t Step(std::uint32_t crc, const std::uint32_t value, const size_t bits) {
+    static constexpr auto table = []() consteval {
+      struct {
+        std::uint32_t values[16];
+      } t{};
+      for (std::uint32_t i = 0; i < 16; i++) {
+        auto value = i;
+        for (size_t bit = 0; bit < 4; bit++) {
+          value = (value & 1) ? ((value >> 1) ^ 0xEDB88320UL) : (value >> 1);
+        }
+        t.values[i] = value;
+      }
+      return t;
+    }();
+    crc ^= value;
+    for (size_t i = 0; i < (bits / 4); i++) {
+      crc = (crc >> 4) ^ table.values[crc & 0x0F];
+    }
+    return crc;
+  }
+
+  // CRC of the checkpoint: the magic and the end of the lines
+  static std::uint32_t Crc(const std::uint32_t first, const std::uint32_t second) { return ~Step(Step(0xFFFFFFFFUL, first, 32), second, 32); }
+
+  // CRC of the data of the line
+  static std::uint32_t Crc(const char *data, const size_t length) {
+    std::uint32_t crc = 0xFFFFFFFFUL;
+    for (size_t i = 0; i < length; i++) {
+      crc = Step(crc, static_cast<unsigned char>(data[i]), 8);
+    }
+    return ~crc;
+  }
+
+  // Size of the line in the ring with its header and footer (aligned to the word)
+  static constexpr std::uint32_t Footprint(const size_t length) {
+    return static_cast<std::uint32_t>(overhead + ((length + sizeof(std::uint32_t) - 1) & ~(sizeof(std::uint32_t) - 1)));
+  }
+
+  // Header and footer of the line: [footprint in words][length]
+  static constexpr std::uint32_t Mark(const std::uint32_t footprint, const std::uint32_t length) {
+    return ((footprint / sizeof(std::uint32_t)) << 16) | length;
+  }
+
+  // Reference to the word at the position of the ring
+  std::atomic_ref<std::uint32_t> word(const std::uint32_t position) const {
+    return std::atomic_ref<std::uint32_t>(memory.words[(position % N) / sizeof(std::uint32_t)]);
+  }
+
+  // Mark the line from the position with the footprint (both ends)
+  void mark(const std::uint32_t position, const std::uint32_t footprint, const std::uint32_t length) const {
+    word(position).store(Mark(footprint, length), std::memory_order_relaxed);
+    word(position + footprint - sizeof(std::uint32_t)).store(Mark(footprint, length), std::memory_order_release);
+  }
+
+  // Save the end of the committed lines in the checkpoint of the commit's turn (if no later line has been saved there)
+  void checkpoint(const std::uint32_t end) const {
+    const auto turn = std::atomic_ref<std::uint32_t>(memory.commits).fetch_add(1, std::memory_order_relaxed);
+    auto &slot = memory.checkpoints[turn & 1];
+    auto saved = std::atomic_ref<std::uint32_t>(slot[0]).load(std::memory_order_relaxed);
+    while (static_cast<std::int32_t>(end - saved) > 0) {
+      if (std::atomic_ref<std::uint32_t>(slot[0]).compare_exchange_weak(saved, end, std::memory_order_relaxed)) {
+        std::atomic_ref<std::uint32_t>(slot[1]).store(Crc(key, end), std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+  // Data of the line that starts at the position (the lines never wrap)
+  const char *data(const std::uint32_t position) const { return &reinterpret_cast<const char *>(memory.words)[(position + sizeof(std::uint32_t)) % N]; }
+
+  // Start of the oldest line that has survived: the lines are walked back from the end while their marks are consistent
+  // (and while they are after the space that might have been marked by the released reservations)
+  std::uint32_t oldest(const std::uint32_t end, const std::uint32_t window) const {
+    auto position = end;
+    std::uint32_t total = 0;
+    while (total < window) {
+      const auto footer = word(position - sizeof(std::uint32_t)).load(std::memory_order_relaxed);
+      const auto footprint = (footer >> 16) * sizeof(std::uint32_t);
+      const auto length = footer & empty;
+      if (!footprint || ((total + footprint) > window) || ((empty != length) && ((length + overhead) > footprint)) ||
+          (footer != word(position - footprint).load(std::memory_order_relaxed))) {
+        break;
+      }
+      position -= footprint;
+      total += footprint;
+    }
+    return position;
+  }
+
+public:
+  /**
+   * @brief   Constructor for the object (the retained memory is checked and cleaned only by flush())
+   *
+   * @param m Reference to the retained memory (in the .noinit section)
+   * @param o Reference to the real Output object
+   */
+  constexpr Retain(Retained<N> &m, const Output &o) : memory(m), out(o) {}
+
+  /**
+   * @brief         Reserve the contiguous space for the line (safe to call from the interrupts and any thread)
+   *                The oldest lines are overwritten, the space is private for the caller until commit()
+   *
+   * @param length  Max length of the line
+   * @return        Pointer to the reserved space, nullptr - dropped (the line is longer than the ring)
+   */
+  char *reserve(const size_t length) const {
+    const auto size = Footprint(length);
+    if ((length >= empty) || (size > N)) {
+      return nullptr;
+    }
+
+    // Reserve the space for the line, the rest of the ring is skipped if the line doesn't fit it
+    auto head = std::atomic_ref<std::uint32_t>(memory.head);
+    auto position = head.load(std::memory_order_relaxed);
+    std::uint32_t skip;
+    do {
+      const auto rest = static_cast<std::uint32_t>(N - (position % N));
+      skip = (size > rest) ? rest : 0;
+    } while (!head.compare_exchange_weak(position, position + skip + size, std::memory_order_relaxed));
+
+    if (skip) {
+      mark(position, skip, empty);
+      position += skip;
+    }
+    mark(position, size, empty); // The reserved footprint (not committed yet)
+    return reinterpret_cast<char *>(&memory.words[(position % N) / sizeof(std::uint32_t) + 1]);
+  }
+
+  /**
+   * @brief         Commit the line that has been built in the reserved space (the unused rest is released if it is the last line)
+   *
+   * @param data    Pointer that has been returned by reserve()
+   * @param length  Actual length of the line (not more than the reserved one)
+   */
+  void commit(char *data, const size_t length) const {
+    const auto offset = static_cast<std::uint32_t>(reinterpret_cast<std::uint32_t *>(data) - memory.words - 1) * sizeof(std::uint32_t);
+    auto head = std::atomic_ref<std::uint32_t>(memory.head);
+    auto end = head.load(std::memory_order_relaxed);
+    auto position = end - static_cast<std::uint32_t>(N) + ((offset - end) % N); // The last position with this offset before the head
+    const auto reserved = (word(position).load(std::memory_order_relaxed) >> 16) * sizeof(std::uint32_t);
+    auto size = Footprint(length);
+    if ((reserved > size) && ((position + reserved) == end)) {
+      // The footer of the reservation stays in the old lines after the release
+      auto reach = std::atomic_ref<std::uint32_t>(memory.reach);
+      if (static_cast<std::int32_t>(end - reach.load(std::memory_order_relaxed)) > 0) {
+        reach.store(end, std::memory_order_relaxed);
+      }
+    }
+    if (!((reserved > size) && ((position + reserved) == end) && head.compare_exchange_strong(end, position + size, std::memory_order_relaxed))) {
+      size = static_cast<std::uint32_t>(reserved); // The rest is after the line (another line has been reserved)
+    }
+    word(position + size - 2 * sizeof(std::uint32_t)).store(Crc(data, length), std::memory_order_relaxed);
+    mark(position, size, static_cast<std::uint32_t>(length));
+    checkpoint(position + size);
+  }
+
+  /**
+   * @brief         Copy the line to the ring (safe to call from the interrupts and any thread)
+   *
+   * @param buffer  Line to be copied
+   * @param length  Length of the line
+   * @return        True if the line has been copied, false - dropped (the line is longer than the ring)
+   */
+  bool write(const char *buffer, const size_t length) const {
+    if (0 == length) {
+      return true;
+    }
+    auto *data = reserve(length);
+    if (nullptr == data) {
+      return false;
+    }
+    std::memcpy(data, buffer, length);
+    commit(data, length);
+    return true;
+  }
+
+  /**
+   * @brief     Copy the string to the ring (safe to call from the interrupts and any thread)
+   *
+   * @param buf String to be copied
+   */
+  void puts(const char *buf) const { write(buf, std::strlen(buf)); }
+
+  /**
+   * @brief   Pass the time from the real Output (needed for iso::log::time concept)
+   *
+   * @return  Time from the real output
+   */
+  auto tick() const
+  requires iso::log::time_func<Output>
+  {
+    return out.tick();
+  }
+
+  /**
+   * @brief   Pass the cycle counter from the real Output (needed for iso::log::cycles and Profile::Enabled)
+   *
+   * @return  Cycles from the real Output
+   */
+  auto cycles() const
+  requires iso::log::cycles_func<Output>
+  {
+    return out.cycles();
+  }
+
+  /**
+   * @brief   Pass the lines that have survived the reset to the real output and start the new history
+   *          (should be called once at the start, before any trace; the memory after the power-on is detected by the magic and CRC,
+   *          the lines with the broken data are skipped by their CRC)
+   *
+   * @return  Quantity of the passed lines
+   */
+  size_t flush() const {
+    size_t quantity = 0;
+    if (key == memory.magic) {
+      // The latest checkpoint that is saved completely
+      bool valid = false;
+      std::uint32_t end = 0;
+      for (const auto &slot : memory.checkpoints) {
+        if ((Crc(key, slot[0]) == slot[1]) && (!valid || (static_cast<std::int32_t>(slot[0] - end) > 0))) {
+          end = slot[0];
+          valid = true;
+        }
+      }
+
+      // The lines after the checkpoint (reserved up to the head or the released reach) have overwritten the oldest ones
+      const auto furthest = (static_cast<std::int32_t>(memory.reach - memory.head) > 0) ? memory.reach : memory.head;
+      const auto beyond = furthest - end;
+      const auto window = static_cast<std::uint32_t>((static_cast<std::int32_t>(beyond) > 0) ? ((beyond < N) ? (N - beyond) : 0) : N);
+      for (auto position = valid ? oldest(end, window) : end; position != end;) {
+        const auto mark = word(position).load(std::memory_order_relaxed);
+        const auto footprint = (mark >> 16) * sizeof(std::uint32_t);
+        const auto length = mark & empty;
+        if ((empty != length) && (Crc(data(position), length) == word(position + footprint - 2 * sizeof(std::uint32_t)).load(std::memory_order_relaxed))) {
+          iso::format::pass(out, data(position), length);
+          quantity++;
+        }
+        position += footprint;
+      }
+    }
+
+    // The new history: the footer before the start is cleared, so the walk back never reaches the old lines
+    memory.head = memory.reach = memory.commits = 0;
+    memory.words[(N / sizeof(std::uint32_t)) - 1] = 0;
+    memory.checkpoints[0][0] = memory.checkpoints[1][0] = 0;
+    memory.checkpoints[0][1] = memory.checkpoints[1][1] = Crc(key, 0);
+    memory.magic = key;
+    return quantity;
+  }
+};
+
+} // namespace iso::output
@@ -0,0 +1,236 @@
+/**
+ * @file    ring.hpp
+ * @author  Ivan Sobchuk (i.a.sobchuk.1994@gmail.com)
+ * @brief   The lock-free ring buffer output for the traces
+ *          from any context (interrupts included).
+ *          Please, check Readme for the details
+ *
+ * @version 1.0.0
+ * @date 2026-10-14
+ *
+ * @copyright Ivan Sobchuk (c) 2026
+ *
+ * License Apache 2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+
+#include "log.hpp"
+
+// C++ concepts should be enabled
+static_assert((__cplusplus >= 201703L) && (__cpp_concepts), "Supported only with C++20 and newer!");
+
+// Basic namespace for the ready-made outputs
+namespace iso::output {
+
+/**
+ * @brief           Lock-free multiple producers single consumer ring buffer that is used as an output for the traces
+ *                  puts()/write() only copy the line to the RAM (never block), drain() passes the lines to the real output
+ *                  Each line is saved as [header][data], the header contains length and is written after the data (commit)
+ *                  reserve()/commit() let the formatter build the whole line in place (iso::format::stage concept):
+ *                  every line is one contiguous entry that never wraps, producers never wait for each other
+ *
+ * @tparam Output   The type that should be satisfied to iso::format::sink concept (real output - RTT, UART, et cetera)
+ * @tparam N        Size of the ring buffer in bytes (should be a power of 2)
+ *
+ * @example         static iso::output::Ring<DebugPuts, 1024> ring{debugPuts};
+ * @example         static constexpr iso::log::Log debug{ring, iso::format::string<"ISR">};
+ * @example         ring.drain(); // In the idle task
+ */
+template <iso::format::sink Output, const size_t N> class Ring final {
+  static_assert((N >= 2 * sizeof(std::uint32_t)) && !(N & (N - 1)), "ERROR: The size of the ring buffer should be a power of 2!");
+
+  static constexpr std::uint32_t committed = 0x80000000UL; // The flag in the header that the line is ready to be passed
+  static constexpr std::uint32_t padding = 0x40000000UL;   // The flag in the header that the space should be skipped
+  static constexpr std::uint32_t mask = ~(committed | padding);
+
+  const Output &out;                                        // Reference to the real Output object
+  mutable std::uint32_t words[N / sizeof(std::uint32_t)]{}; // The ring buffer (word-aligned headers)
+  mutable std::atomic<size_t> head{};                       // Position of the next reservation (producers)
+  mutable std::atomic<size_t> tail{};                       // Position of the next line to be passed (consumer)
+  mutable std::atomic<size_t> drops{};                      // Quantity of the lines that were dropped (the buffer was full)
+
+  // Size of the line in the buffer with its header (aligned to the header)
+  static constexpr size_t Footprint(const size_t length) {
+    return sizeof(std::uint32_t) + ((length + sizeof(std::uint32_t) - 1) & ~(sizeof(std::uint32_t) - 1));
+  }
+
+  // Reference to the header of the line that starts at the position
+  std::atomic_ref<std::uint32_t> header(const size_t position) const { return std::atomic_ref<std::uint32_t>(words[(position % N) / sizeof(std::uint32_t)]); }
+
+  // Pass the data from the ring buffer to the real output (the lines never wrap): write(), writev() or puts() by the pieces
+  void pass(const size_t position, const size_t length) const {
+    iso::format::pass(out, &reinterpret_cast<const char *>(words)[position % N], length);
+  }
+
+public:
+  /**
+   * @brief   Constructor for the object (the ring buffer itself is constant-initialized)
+   *
+   * @param o Reference to the real Output object
+   */
+  constexpr Ring(const Output &o) : out(o) {}
+
+  /**
+   * @brief         Reserve the contiguous space for the line (safe to call from the interrupts and any thread)
+   *                The space is private for the caller until commit(), the other producers don't wait for it
+   *
+   * @param length  Max length of the line
+   * @return        Pointer to the reserved space, nullptr - dropped (the buffer is full)
+   */
+  char *reserve(const size_t length) const {
+    const auto size = Footprint(length);
+    if (size > N) {
+      drops.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    // Reserve the space for the line, the rest of the buffer is skipped if the line doesn't fit it
+    auto position = head.load(std::memory_order_relaxed);
+    size_t skip;
+    do {
+      const auto rest = N - (position % N);
+      skip = (size > rest) ? rest : 0;
+      if ((position + skip + size - tail.load(std::memory_order_acquire)) > N) {
+        drops.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+      }
+    } while (!head.compare_exchange_weak(position, position + skip + size, std::memory_order_relaxed));
+
+    if (skip) {
+      header(position).store(committed | padding | (skip - sizeof(std::uint32_t)), std::memory_order_release);
+      position += skip;
+    }
+    header(position).store(size, std::memory_order_relaxed); // The reserved footprint (not committed yet)
+    return reinterpret_cast<char *>(&words[(position % N) / sizeof(std::uint32_t) + 1]);
+  }
+
+  /**
+   * @brief         Commit the line that has been built in the reserved space (the unused rest is skipped)
+   *
+   * @param data    Pointer that has been returned by reserve()
+   * @param length  Actual length of the line (not more than the reserved one)
+   */
+  void commit(char *data, const size_t length) const {
+    const auto position = static_cast<size_t>(reinterpret_cast<std::uint32_t *>(data) - words - 1) * sizeof(std::uint32_t);
+    const auto reserved = header(position).load(std::memory_order_relaxed);
+    const auto size = Footprint(length);
+    if (reserved > size) {
+      // The unused rest is released if it is the last reservation, otherwise it is skipped by the consumer
+      std::memset(&data[size - sizeof(std::uint32_t)], 0, reserved - size);
+      auto end = head.load(std::memory_order_relaxed);
+      if (((end % N) != ((position + reserved) % N)) || !head.compare_exchange_strong(end, end - (reserved - size), std::memory_order_release)) {
+        header(position + size).store(committed | padding | (reserved - size - sizeof(std::uint32_t)), std::memory_order_relaxed);
+      }
+    }
+    header(position).store(committed | length, std::memory_order_release);
+  }
+
+  /**
+   * @brief         Copy the line to the ring buffer (safe to call from the interrupts and any thread)
+   *
+   * @param buffer  Line to be copied
+   * @param length  Length of the line
+   * @return        True if the line has been copied, false - dropped (the buffer is full)
+   */
+  bool write(const char *buffer, const size_t length) const {
+    if (0 == length) {
+      return true;
+    }
+    auto *data = reserve(length);
+    if (nullptr == data) {
+      return false;
+    }
+    std::memcpy(data, buffer, length);
+    commit(data, length);
+    return true;
+  }
+
+  /**
+   * @brief     Copy the string to the ring buffer (safe to call from the interrupts and any thread)
+   *
+   * @param buf String to be copied
+   */
+  void puts(const char *buf) const { write(buf, std::strlen(buf)); }
+
+  /**
+   * @brief   Pass the time from the real Output (needed for iso::log::time concept)
+   *
+   * @return  Time from the real output
+   */
+  auto tick() const
+  requires iso::log::time_func<Output>
+  {
+    return out.tick();
+  }
+
+  /**
+   * @brief   Pass the cycle counter from the real Output (needed for iso::log::cycles and Profile::Enabled)
+   *
+   * @return  Cycles from the real Output
+   */
+  auto cycles() const
+  requires iso::log::cycles_func<Output>
+  {
+    return out.cycles();
+  }
+
+  /**
+   * @brief   Pass all committed lines to the real output (should be called from the only one context, for example idle task)
+   *
+   * @return  Quantity of the passed lines
+   */
+  size_t drain() const {
+    size_t quantity = 0;
+    auto position = tail.load(std::memory_order_relaxed);
+    while (position != head.load(std::memory_order_acquire)) {
+      const auto length = header(position).load(std::memory_order_acquire);
+      if (!(length & committed)) {
+        break; // The line is still being built
+      }
+      if (!(length & padding)) {
+        pass(position + sizeof(std::uint32_t), length & mask);
+        quantity++;
+      }
+
+      // Clean the space for the next headers and release it
+      const auto size = Footprint(length & mask);
+      for (size_t i = 0; i < size; i += sizeof(std::uint32_t)) {
+        header(position + i).store(0, std::memory_order_relaxed);
+      }
+      position += size;
+      tail.store(position, std::memory_order_release);
+    }
+    return quantity;
+  }
+
+  /**
+   * @brief   Quantity of the lines that were dropped because the buffer was full
+   *
+   * @return  Quantity of the dropped lines
+   */
+  size_t dropped() const { return drops.load(std::memory_order_relaxed); }
+};
+
+} // namespace iso::output
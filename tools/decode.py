@@ -0,0 +1,309 @@
+#!/usr/bin/env python3
+"""
+@file    decode.py
+@brief   Host decoder for the binary traces (iso::log::Encoding::Binary).
+         Takes the ELF file of the firmware and the captured output (RTT, UART, et cetera)
+         and prints the traces the same way as the target does in the text encoding.
+         Please, check Readme for the details
+
+@example python3 tools/decode.py firmware.elf capture.bin
+@example python3 tools/decode.py -l firmware.elf capture.bin  # "file:line " before the located traces
+@example python3 tools/decode.py -b firmware.elf  # worst-case sizes of the call sites (iso::log::budget<size, true>)
+@example JLinkRTTLogger ... && python3 tools/decode.py firmware.elf - < capture.bin
+
+License Apache 2.0
+"""
+
+import struct
+import sys
+from fractions import Fraction
+
+TRACE_SECTION = ".iso_trace"
+LENGTH_SECTION = ".iso_length"
+LENGTH_ENTRY = ".rodata._ZN3iso3log6Listed"  # The entries of the compilers that ignore the section attribute for the templates
+BUFFER_FIELD = 0x80  # The field size with this bit set is a DataBuffer
+TEXT_FIELD = 0x40  # The field size with this bit set is a run-time string: [length][characters]
+VARINT_FIELD = 0x20  # The field size with this bit set is LEB128 (the length of the DataBuffer with BUFFER_FIELD)
+ZIGZAG_FIELD = 0x01  # The LEB128 of the signed value: 0, -1, 1, -2 -> 0, 1, 2, 3
+TIME_FIELD = 0x10  # The LEB128 of the time: (difference << 1) or (absolute << 1 | 1), lower bits - decimals
+LAYOUT_FIELD = 0x10  # The DataBuffer with this bit set: [length][separator (1 byte)][LEB128 of the bytes per line] before the data
+TIMESTAMP_SIZE = 9  # The '%t' field with the resolution: [decimals][64-bit value]
+FIXED_UNSIGNED = 0x80  # The '%q' field of the unsigned raw value
+FLOAT_LIMIT = 2**64  # The finite '%f' values that are not less than it are printed as "overflow" by the target
+ID_SIZE = 4
+LOCATED = 0x80  # The quantity of fields with this bit set: the source location string follows the format string
+
+
+class Elf:
+    """Minimal ELF reader: only section headers are needed to find the descriptors"""
+
+    def __init__(self, path):
+        with open(path, "rb") as file:
+            self.data = file.read()
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} is not an ELF file")
+        is64 = self.data[4] == 2
+        self.endian = "<" if self.data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(self.endian + "Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", self.data, 0x3A)
+            header = "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(self.endian + "I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", self.data, 0x2E)
+            header = "IIIIIIIIII"
+        raw = [struct.unpack_from(self.endian + header, self.data, shoff + i * shentsize) for i in range(shnum)]
+        names = raw[shstrndx][4]
+        self.sections = []
+        for name, kind, _, addr, offset, size, *_ in raw:
+            # SHT_NOBITS sections don't have data in the file
+            if kind == 8 or size == 0:
+                continue
+            end = self.data.index(b"\0", names + name)
+            self.sections.append((self.data[names + name:end].decode(), addr, offset, size))
+        # The dedicated section is checked first (it can overlap with the others as it is not loaded)
+        self.sections.sort(key=lambda s: s[0] != TRACE_SECTION and not s[0].startswith(TRACE_SECTION + "."))
+
+    def read(self, address):
+        """Returns bytes from the address up to the end of the section"""
+        for _, addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                return self.data[offset + address - addr:offset + size]
+        raise KeyError(f"Unknown record ID 0x{address:08X}")
+
+
+class Descriptor:
+    """Compile-time descriptor: [quantity of fields][size of each field][string with '\\0']([file:line with '\\0'])"""
+
+    def __init__(self, raw):
+        quantity = raw[0] & ~LOCATED
+        self.fields = list(raw[1:1 + quantity])
+        end = raw.index(b"\0", 1 + quantity)
+        self.string = raw[1 + quantity:end].decode(errors="replace")
+        self.location = raw[end + 1:raw.index(b"\0", end + 1)].decode(errors="replace") if raw[0] & LOCATED else None
+        self.specifiers = parse(self.string)
+
+
+def parse(string):
+    """Splits the string into literals and specifiers the same way as Format::SpecifierTable does"""
+    parts = []
+    i = 0
+    literal = ""
+    while i < len(string):
+        if string[i] != "%":
+            literal += string[i]
+            i += 1
+            continue
+        parts.append(literal)
+        literal = ""
+        i += 1
+        bare = i < len(string) and string[i] == "#"
+        if bare:
+            i += 1
+        width = ""
+        while i < len(string) and string[i].isdigit():
+            width += string[i]
+            i += 1
+        precision = 6
+        if i < len(string) and string[i] == ".":
+            digits = ""
+            i += 1
+            while i < len(string) and string[i].isdigit():
+                digits += string[i]
+                i += 1
+            precision = int(digits) if digits else 0
+        spec = string[i] if i < len(string) else ""
+        parts.append((spec, int(width) if width else 0, bare, precision))
+        i += 1
+    parts.append(literal)
+    return parts
+
+
+class Decoder:
+    def __init__(self, elf, located=False):
+        self.elf = elf
+        self.located = located
+        self.descriptors = {}
+        self.time = 0  # Time of the previous record (the traces before the first absolute time are relative to the capture start)
+
+    def descriptor(self, record):
+        if record not in self.descriptors:
+            self.descriptors[record] = Descriptor(self.elf.read(record))
+        return self.descriptors[record]
+
+    def integer(self, raw, signed=False):
+        return int.from_bytes(raw, "little" if self.elf.endian == "<" else "big", signed=signed)
+
+    @staticmethod
+    def varint(stream, position):
+        """LEB128 from the position: returns the value and the position after it"""
+        value = shift = 0
+        while position < len(stream):
+            byte = stream[position]
+            position += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        return value, position
+
+    def compact(self, spec, width, size, value):
+        """Field in LEB128: decimals, time difference (or absolute time)"""
+        if size & TIME_FIELD:
+            self.time = value >> 1 if value & 1 else self.time + (value >> 1)
+            decimals = size & 0x0F
+            return "{}.{:0{}}".format(self.time // 10**decimals, self.time % 10**decimals, decimals)
+        if size & ZIGZAG_FIELD:
+            value = (value >> 1) ^ -(value & 1)
+        return ("-" if value < 0 else "") + str(abs(value)).zfill(width)
+
+    @staticmethod
+    def hexadecimal(data, separator, per_line):
+        """Bytes of the DataBuffer the same way as the target: the separator before each byte ('\\0' - none), CRLF after each per_line bytes"""
+        separator = "" if separator == 0 else chr(separator)
+        text = ""
+        for i, byte in enumerate(data):
+            if per_line and i and i % per_line == 0:
+                text += "\r\n"
+            text += "{}{:02X}".format(separator, byte)
+        return text + "\r\n"
+
+    @staticmethod
+    def fraction(value, precision):
+        """Decimal of the non-negative value with the precision digits, rounded to the nearest even the same way as the target"""
+        digits = round(value * 10**precision)
+        text = str(digits // 10**precision)
+        if precision:
+            text += ".{:0{}}".format(digits % 10**precision, precision)
+        return text
+
+    def format(self, spec, width, bare, precision, raw):
+        if spec == "d":
+            value = self.integer(raw, signed=True)
+            return ("-" if value < 0 else "") + str(abs(value)).zfill(width)
+        if spec == "u":
+            return str(self.integer(raw)).zfill(width)
+        if spec in ("X", "x", "p"):
+            digits = format(self.integer(raw), "0{}{}".format(width or 2 * len(raw), "x" if spec == "x" else "X"))
+            return digits if bare else "0x" + digits
+        if spec == "c":
+            return raw.decode(errors="replace")
+        if spec == "s":
+            return self.descriptor(self.integer(raw)).string
+        if spec == "t":
+            # Plain tick() in milliseconds or Timestamp: [decimals (1 byte)][value (8 bytes)]
+            decimals, value = (raw[0], self.integer(raw[1:])) if len(raw) == TIMESTAMP_SIZE else (3, self.integer(raw))
+            return "{}.{:0{}}".format(value // 10**decimals, value % 10**decimals, decimals)
+        if spec == "b":
+            return "TRUE" if raw[0] else "FALSE"
+        if spec == "f":
+            value, = struct.unpack(self.elf.endian + ("f" if len(raw) == 4 else "d"), raw)
+            sign = "-" if struct.pack(">d", value)[0] & 0x80 else ""
+            if value != value:
+                return sign + "nan"
+            if abs(value) == float("inf"):
+                return sign + "inf"
+            if abs(value) >= FLOAT_LIMIT:
+                return sign + "overflow"
+            return sign + self.fraction(abs(Fraction(value)), precision)
+        if spec == "q":
+            # Fixed-point: [quantity of the fraction bits (the highest bit is set for unsigned)][raw value]
+            value = Fraction(self.integer(raw[1:], signed=not raw[0] & FIXED_UNSIGNED), 2**(raw[0] & ~FIXED_UNSIGNED))
+            return ("-" if value < 0 else "") + self.fraction(abs(value), precision)
+        return ""
+
+    def decode(self, stream):
+        """Generator of the formatted traces from the captured stream"""
+        position = 0
+        while position + ID_SIZE <= len(stream):
+            desc = self.descriptor(self.integer(stream[position:position + ID_SIZE]))
+            position += ID_SIZE
+            fields = iter(desc.fields)
+            text = desc.location + " " if self.located and desc.location else ""
+            for part in desc.specifiers:
+                if isinstance(part, str):
+                    text += part
+                    continue
+                size = next(fields)
+                if size & TEXT_FIELD and not size & BUFFER_FIELD:
+                    prefix = size & ~TEXT_FIELD
+                    length = self.integer(stream[position:position + prefix])
+                    position += prefix
+                    text += stream[position:position + length].decode(errors="replace")
+                    position += length
+                    continue
+                if size & VARINT_FIELD and not size & BUFFER_FIELD:
+                    value, position = self.varint(stream, position)
+                    text += self.compact(part[0], part[1], size, value)
+                    continue
+                text += self.format(*part, stream[position:position + size])
+                position += size
+            for size in fields:
+                if not size & BUFFER_FIELD:
+                    continue
+                if size & VARINT_FIELD:
+                    length, position = self.varint(stream, position)
+                else:
+                    length = self.integer(stream[position:position + (size & ~BUFFER_FIELD)])
+                    position += size & ~BUFFER_FIELD
+                separator, per_line = ord(" "), 0  # The records before the layout was kept
+                if size & VARINT_FIELD and size & LAYOUT_FIELD:
+                    separator = stream[position]
+                    per_line, position = self.varint(stream, position + 1)
+                text += self.hexadecimal(stream[position:position + length], separator, per_line)
+                position += length
+            yield text
+
+
+def lengths(elf):
+    """Worst-case sizes of the call sites: [size][format string with '\\0'][file:line with '\\0'], the entries are aligned"""
+    for name, _, offset, size in elf.sections:
+        if name != LENGTH_SECTION and not name.startswith(LENGTH_SECTION + ".") and not name.startswith(LENGTH_ENTRY):
+            continue
+        raw = elf.data[offset:offset + size]
+        position = 0
+        while position + 4 <= len(raw):
+            worst, = struct.unpack_from(elf.endian + "I", raw, position)
+            # The size is never 0, so the zero words are the alignment between the entries
+            if worst == 0:
+                position += 4
+                continue
+            end = raw.index(b"\0", position + 4)
+            place = raw.index(b"\0", end + 1)
+            yield worst, raw[position + 4:end].decode(errors="replace"), raw[end + 1:place].decode(errors="replace")
+            position = (place + 4) & ~3
+
+
+def budget(paths):
+    """Prints the call sites from the largest one and the global maximum (to size the buffers of the outputs)"""
+    entries = sorted({entry for path in paths for entry in lengths(Elf(path))}, key=lambda e: (-e[0], e[2], e[1]))
+    for worst, string, location in entries:
+        print(f"{worst:6} {location + ' ' if location else ''}{string!r}")
+    print(f"max {entries[0][0] if entries else 0}")
+    return 0
+
+
+def main(argv):
+    if argv[1:2] == ["-b"] and len(argv) > 2:
+        return budget(argv[2:])
+    located = "-l" in argv[1:2]
+    if located:
+        argv = argv[:1] + argv[2:]
+    if len(argv) != 3:
+        print(__doc__.strip().split("\n\n")[0], file=sys.stderr)
+        print(f"usage: {argv[0]} [-l] <firmware.elf> <capture.bin | ->", file=sys.stderr)
+        print(f"       {argv[0]} -b <firmware.elf | object.o>...", file=sys.stderr)
+        return 1
+    decoder = Decoder(Elf(argv[1]), located)
+    if argv[2] == "-":
+        stream = sys.stdin.buffer.read()
+    else:
+        with open(argv[2], "rb") as file:
+            stream = file.read()
+    for text in decoder.decode(stream):
+        sys.stdout.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))